@@ -0,0 +1,52 @@
+#include "allocators.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+VatAllocator::~VatAllocator() {
+  for (auto &block : blocks) {
+    free(block.data);
+  }
+}
+
+void *VatAllocator::allocate(size_t size, size_t align) {
+  while (current < blocks.size()) {
+    auto &block = blocks[current];
+    // Blocks come from malloc, so offsets aligned here are aligned in memory
+    size_t start = (used + align - 1) & ~(align - 1);
+    if (start + size <= block.size) {
+      used = start + size;
+      return block.data + start;
+    }
+    ++current;
+    used = 0;
+  }
+
+  Block block;
+  block.size = std::max(ARENA_BLOCK_SIZE, size);
+  block.data = (char *)malloc(block.size);
+  if (!block.data) {
+    throw std::bad_alloc();
+  }
+  blocks.push_back(block);
+
+  current = blocks.size() - 1;
+  used = size;
+  return block.data;
+}
+
+void VatAllocator::release(void *p, size_t size) {
+  if (current < blocks.size() && (char *)p + size == blocks[current].data + used) {
+    used = (char *)p - blocks[current].data;
+  }
+}
+
+void VatAllocator::reset() {
+  while (blocks.size() > ARENA_KEPT_BLOCKS) {
+    free(blocks.back().data);
+    blocks.pop_back();
+  }
+  current = 0;
+  used = 0;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <type_traits>
+#include <vector>
+
+#include "common.h"
+
+// 64k per block, requests larger than that get a block of their own
+const size_t ARENA_BLOCK_SIZE = 64 * 1024;
+// Blocks kept across reset(), any beyond these go back to the heap
+const size_t ARENA_KEPT_BLOCKS = 16;
+
+// Per-vat bump arena for what a message handler only needs while it runs:
+// stack frames, locals, scopes, operand stacks and argument lists.  Nothing
+// is freed on its own, reset() drops everything at once after the handler
+// returns.  Values outlive it by being copied into ordinary containers
+// (entity data, Msg::values, promise results), the objects they point to
+// belong to the vat's GC and never live here.
+struct VatAllocator {
+  struct Block {
+    char *data;
+    size_t size;
+  };
+
+  std::vector<Block> blocks;
+  // Block being carved from and how much of it is taken
+  size_t current = 0;
+  size_t used = 0;
+
+  VatAllocator() = default;
+  VatAllocator(const VatAllocator &) = delete;
+  VatAllocator &operator=(const VatAllocator &) = delete;
+  ~VatAllocator();
+
+  void *allocate(size_t size, size_t align);
+  // Only the most recent allocation can be given back, which is enough for
+  // argument lists that come and go around a call
+  void release(void *p, size_t size);
+  void reset();
+};
+
+// Carves from arena, or uses the heap when it's nullptr (as for vats
+// without one).
+template <typename T>
+struct ArenaAllocator {
+  typedef T value_type;
+  typedef std::true_type propagate_on_container_copy_assignment;
+  typedef std::true_type propagate_on_container_move_assignment;
+  typedef std::true_type propagate_on_container_swap;
+
+  VatAllocator *arena = nullptr;
+
+  ArenaAllocator() = default;
+  ArenaAllocator(VatAllocator *vat_arena) : arena(vat_arena) {}
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U> &other) : arena(other.arena) {}
+
+  T *allocate(size_t n) {
+    if (!arena) {
+      return (T *)::operator new(n * sizeof(T));
+    }
+    return (T *)arena->allocate(n * sizeof(T), alignof(T));
+  }
+
+  void deallocate(T *p, size_t n) {
+    if (!arena) {
+      ::operator delete(p);
+    } else {
+      arena->release(p, n * sizeof(T));
+    }
+  }
+
+  template <typename U>
+  bool operator==(const ArenaAllocator<U> &other) const { return arena == other.arena; }
+  template <typename U>
+  bool operator!=(const ArenaAllocator<U> &other) const { return arena != other.arena; }
+};
+
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+template <typename K, typename V>
+using ArenaMap = std::map<K, V, std::less<K>, ArenaAllocator<std::pair<const K, V>>>;
@@ -10,11 +10,21 @@ std::vector<std::string> acceptable_opts = {
   "local-host",
   "remote-host",
   "program",
-  "entity"
+  "entity",
+  "burners",
+  "slice-msgs",
+  "slice-reductions",
+  "vats",
+  "steps",
+  "idle-vats",
+  "timers",
+  "engine",
+  "memo-size"
 };
 
 std::vector<std::string> acceptable_flags = {
-  "v"
+  "v",
+  "node-counts"
 };
 
 PleromaArgs parse_args(int argc, char** argv) {
@@ -27,20 +37,31 @@ PleromaArgs parse_args(int argc, char** argv) {
   }
 
   if (vargs.size() < 1) {
-    throw PleromaException("Must use command [start, test]");
+    throw PleromaException("Must use command [start, test, bench]");
   }
 
   if (vargs[0] == "start") {
     pargs.command = PCommand::Start;
   } else if (vargs[0] == "test") {
     pargs.command = PCommand::Test;
+
+    if (vargs.size() < 2) {
+      throw PleromaException("Must give a file to test");
+    }
+    pargs.program_path = vargs[1];
+  } else if (vargs[0] == "bench") {
+    pargs.command = PCommand::Bench;
+    pargs.program_path = "examples/bench-spin.plm";
+    pargs.entity_name = "Spinner";
   } else {
-    throw PleromaException("Need valid command: start or test.");
+    throw PleromaException("Need valid command: start, test or bench.");
   }
 
-  if (pargs.command == PCommand::Start) {
+  if (pargs.command == PCommand::Start || pargs.command == PCommand::Bench || pargs.command == PCommand::Test) {
+    // test takes its file first
+    int first_opt = pargs.command == PCommand::Test ? 2 : 1;
 
-    for (int k = 1; k < vargs.size(); ++k) {
+    for (int k = first_opt; k < vargs.size(); ++k) {
       // Option vs flag
       if (vargs[k][0] == '-' && vargs[k][1] == '-') {
         std::string opt_name = std::string(vargs[k].begin()+2, vargs[k].end());
@@ -67,11 +88,43 @@ PleromaArgs parse_args(int argc, char** argv) {
           pargs.program_path = opt_val;
         } else if (opt_name == "entity") {
           pargs.entity_name = opt_val;
+        } else if (opt_name == "burners") {
+          pargs.burners = std::stoi(opt_val);
+        } else if (opt_name == "slice-msgs") {
+          pargs.slice_msgs = std::stoi(opt_val);
+        } else if (opt_name == "slice-reductions") {
+          pargs.slice_reductions = std::stoull(opt_val);
+        } else if (opt_name == "vats") {
+          pargs.bench_vats = std::stoi(opt_val);
+        } else if (opt_name == "steps") {
+          pargs.bench_steps = std::stoi(opt_val);
+        } else if (opt_name == "idle-vats") {
+          pargs.bench_idle_vats = std::stoi(opt_val);
+        } else if (opt_name == "timers") {
+          pargs.bench_timers = std::stoi(opt_val);
+        } else if (opt_name == "engine") {
+          if (opt_val != "tree" && opt_val != "bytecode") {
+            throw PleromaException(("Invalid engine, must be tree or bytecode: " + opt_val).c_str());
+          }
+          pargs.engine = opt_val;
+        } else if (opt_name == "memo-size") {
+          pargs.memo_size = std::stoi(opt_val);
         } else {
           throw PleromaException(("Invalid command-line option: " + opt_name).c_str());
         }
 
         } else if (vargs[k][0] == '-') {
+          std::string flag_name = std::string(vargs[k].begin() + 1, vargs[k].end());
+
+          if (std::find(acceptable_flags.begin(), acceptable_flags.end(), flag_name) == acceptable_flags.end()) {
+            throw PleromaException(("Invalid command-line flag: " + flag_name).c_str());
+          }
+
+          if (flag_name == "v") {
+            pargs.verbose = true;
+          } else if (flag_name == "node-counts") {
+            pargs.dump_node_counts = true;
+          }
         }
     }
   }
@@ -5,7 +5,8 @@
 
 enum class PCommand {
   Start,
-  Test
+  Test,
+  Bench
 };
 
 struct PleromaArgs {
@@ -21,6 +22,28 @@ struct PleromaArgs {
   std::string program_path = "examples/helloworld.plm";
   // In the future, we should automatically find this
   std::string entity_name = "UserProgram";
+
+  // Burner threads, 0 means one per core
+  int burners = 0;
+
+  // Per-slice budget, 0 means unlimited
+  int slice_msgs = 100;
+  u64 slice_reductions = 200000;
+
+  bool verbose = false;
+  // Log AST node counts before and after optimising
+  bool dump_node_counts = false;
+
+  // tree or bytecode
+  std::string engine = "tree";
+
+  // Pure function results cached per vat, 0 is off
+  int memo_size = 0;
+
+  int bench_vats = 64;
+  int bench_steps = 2000;
+  int bench_idle_vats = 10000;
+  int bench_timers = 200000;
 };
 
 PleromaArgs parse_args(int argc, char** argv);
@@ -0,0 +1,351 @@
+#include "bench.h"
+#include "general_util.h"
+#include "hylic.h"
+#include "hylic_eval.h"
+#include "netcode.h"
+#include "other.h"
+#include "pleroma.h"
+#include "scheduler.h"
+#include "timer_wheel.h"
+
+#include <chrono>
+#include <ctime>
+#include <deque>
+#include <thread>
+#include <vector>
+
+const int BENCH_TIMEOUT_S = 120;
+const int BENCH_WAKES = 100;
+const int BENCH_TIMER_VATS = 256;
+const int BENCH_TIMER_SPREAD_MS = 1000;
+const int BENCH_PROMISES = 2000000;
+const int BENCH_PROMISES_IN_FLIGHT = 4096;
+const int BENCH_ENTITIES = 500000;
+const int BENCH_ENTITY_LOOKUPS = 10000000;
+const int BENCH_COUNT_LOOPS = 10000;
+const int BENCH_COUNT_RUNS = 20;
+
+Msg spin_msg(Entity *ent, int steps) {
+  Msg m;
+  m.node_id = ent->address.node_id;
+  m.vat_id = ent->address.vat_id;
+  m.entity_id = ent->address.entity_id;
+  m.method_id = intern_method("spin");
+
+  m.src_entity_id = -1;
+  m.src_node_id = -1;
+  m.src_vat_id = -1;
+  m.promise_id = -1;
+
+  m.values.push_back(make_number_value(0));
+  m.values.push_back(make_number_value(steps));
+
+  return m;
+}
+
+Vat *bench_vat(EntityDef *entity_def, int steps) {
+  Vat *vat = create_vat(this_pleroma_node);
+
+  // Gone before start_vat(), a burner resets the arena it carves from
+  Entity *ent;
+  {
+    EvalContext context;
+    start_context(&context, this_pleroma_node, vat, entity_def->module, nullptr);
+    ent = create_entity(&context, entity_def, false);
+  }
+
+  deliver_msg(spin_msg(ent, steps));
+  start_vat(vat);
+
+  return vat;
+}
+
+void wait_for_messages(u64 expected, std::chrono::steady_clock::time_point start) {
+  while (scheduler_stats().messages < expected) {
+    route_messages();
+
+    if (std::chrono::steady_clock::now() - start > std::chrono::seconds(BENCH_TIMEOUT_S)) {
+      panic("Bench timed out");
+    }
+  }
+}
+
+double bench_burners(EntityDef *entity_def, int n_burners, int n_vats, int steps, SchedulerStats *stats) {
+  init_scheduler(n_burners);
+
+  // spin(n) calls itself until n reaches the limit: steps + 1 calls and a
+  // response to each of them except the first, which goes back to the void
+  u64 expected = (u64)n_vats * (2 * steps + 1);
+
+  for (int k = 0; k < n_vats; ++k) {
+    bench_vat(entity_def, steps);
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  start_burners(process_vq);
+
+  wait_for_messages(expected, start);
+
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  stop_burners();
+
+  *stats = scheduler_stats();
+  print_scheduler_stats();
+
+  // Drain vats still waiting on the router
+  route_messages();
+  reset_scheduler();
+
+  return elapsed.count();
+}
+
+// Parks a large number of vats, then measures CPU use while they idle and how
+// long a parked vat takes to wake up
+void bench_idle(EntityDef *entity_def, int n_burners, int n_vats) {
+  init_scheduler(n_burners);
+
+  std::vector<Vat *> idle_vats;
+  for (int k = 0; k < n_vats; ++k) {
+    idle_vats.push_back(bench_vat(entity_def, 0));
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  start_burners(process_vq);
+  wait_for_messages(n_vats, start);
+
+  clock_t cpu_start = clock();
+  auto wall_start = std::chrono::steady_clock::now();
+  std::this_thread::sleep_for(std::chrono::seconds(1));
+  double cpu_secs = (double)(clock() - cpu_start) / CLOCKS_PER_SEC;
+  std::chrono::duration<double> wall = std::chrono::steady_clock::now() - wall_start;
+
+  double total_wake_us = 0;
+  double max_wake_us = 0;
+  for (int k = 0; k < BENCH_WAKES; ++k) {
+    Vat *vat = idle_vats[(k * 7919) % n_vats];
+    u64 before = scheduler_stats().messages;
+
+    auto wake_start = std::chrono::steady_clock::now();
+    deliver_msg(spin_msg(find_entity(vat, 0), 0));
+    wait_for_messages(before + 1, wake_start);
+    std::chrono::duration<double, std::micro> wake = std::chrono::steady_clock::now() - wake_start;
+
+    total_wake_us += wake.count();
+    max_wake_us = std::max(max_wake_us, wake.count());
+  }
+
+  stop_burners();
+  route_messages();
+  reset_scheduler();
+
+  dbp(log_info, "%d idle vats: %.1f%% CPU while parked, wake latency %.1fus avg, %.1fus max", n_vats, 100 * cpu_secs / wall.count(),
+      total_wake_us / BENCH_WAKES, max_wake_us);
+}
+
+// Arms a large number of timers spread over a second, cancels every other
+// one and waits for the rest to fire
+void bench_timers(EntityDef *entity_def, int n_burners, int n_timers) {
+  init_scheduler(n_burners);
+
+  std::vector<Vat *> timer_vats;
+  for (int k = 0; k < BENCH_TIMER_VATS; ++k) {
+    timer_vats.push_back(bench_vat(entity_def, 0));
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  start_burners(process_vq);
+  wait_for_messages(BENCH_TIMER_VATS, start);
+
+  std::vector<Msg> timer_msgs;
+  for (int k = 0; k < n_timers; ++k) {
+    timer_msgs.push_back(spin_msg(find_entity(timer_vats[k % BENCH_TIMER_VATS], 0), 0));
+  }
+
+  std::vector<u64> timer_ids;
+  auto insert_start = std::chrono::steady_clock::now();
+  for (int k = 0; k < n_timers; ++k) {
+    u64 delay = 1 + (k * 7919) % BENCH_TIMER_SPREAD_MS;
+    timer_ids.push_back(add_timer(delay, 0, std::move(timer_msgs[k])));
+  }
+  std::chrono::duration<double, std::nano> insert_time = std::chrono::steady_clock::now() - insert_start;
+
+  auto cancel_start = std::chrono::steady_clock::now();
+  int n_cancelled = 0;
+  for (int k = 0; k < n_timers; k += 2) {
+    n_cancelled += cancel_timer(timer_ids[k]);
+  }
+  std::chrono::duration<double, std::nano> cancel_time = std::chrono::steady_clock::now() - cancel_start;
+
+  wait_for_messages(BENCH_TIMER_VATS + n_timers - n_cancelled, insert_start);
+  std::chrono::duration<double, std::milli> fired = std::chrono::steady_clock::now() - insert_start;
+
+  stop_burners();
+  route_messages();
+  reset_scheduler();
+
+  dbp(log_info, "%d timers: %.0fns/insert, %.0fns/cancel, %d fired, last after %.0fms (latest deadline %.0fms)", n_timers,
+      insert_time.count() / n_timers, cancel_time.count() / std::max(1, n_timers / 2), n_timers - n_cancelled, fired.count(),
+      BENCH_TIMER_SPREAD_MS + insert_time.count() / 1e6);
+}
+
+// Drives a vat's promise table the way async calls do: each promise is
+// created, looked up a few times while it is in flight, then resolved and
+// reclaimed, with a window of others outstanding
+void bench_promises() {
+  Vat *vat = new Vat;
+
+  std::deque<int> in_flight;
+  u64 n_stale = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  for (int k = 0; k < BENCH_PROMISES; ++k) {
+    in_flight.push_back(vat->promises.insert(PromiseResult()));
+
+    if (in_flight.size() > BENCH_PROMISES_IN_FLIGHT) {
+      int promise_id = in_flight.front();
+      in_flight.pop_front();
+
+      PromiseResult *promise = vat->promises.find(promise_id);
+      promise->resolved = true;
+      settle_promise(vat, promise);
+      vat->promises.erase(promise_id);
+
+      // A late response for the same id must not find anything
+      n_stale += vat->promises.find(promise_id) == nullptr;
+    }
+  }
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+  dbp(log_info, "%d promises: %.0fns per create/resolve/reclaim, %lu/%lu stale ids rejected", BENCH_PROMISES, elapsed.count() / BENCH_PROMISES,
+      (unsigned long)n_stale, (unsigned long)(BENCH_PROMISES - BENCH_PROMISES_IN_FLIGHT));
+
+  delete vat;
+}
+
+// Dispatch cost in a vat holding many entities: every message resolves its
+// target entity id
+void bench_entities() {
+  Vat *vat = new Vat;
+
+  std::vector<int> entity_ids;
+  for (int k = 0; k < BENCH_ENTITIES; ++k) {
+    entity_ids.push_back(vat->entities.insert(new Entity));
+  }
+
+  u64 n_found = 0;
+  u32 pick = 1;
+  auto start = std::chrono::steady_clock::now();
+  for (int k = 0; k < BENCH_ENTITY_LOOKUPS; ++k) {
+    pick = pick * 1664525 + 1013904223;
+    n_found += find_entity(vat, entity_ids[pick % BENCH_ENTITIES]) != nullptr;
+  }
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+  // Ids from before a slot was reused must not resolve
+  for (int k = 0; k < BENCH_ENTITIES; k += 2) {
+    delete find_entity(vat, entity_ids[k]);
+    vat->entities.erase(entity_ids[k]);
+    vat->entities.insert(new Entity);
+  }
+
+  u64 n_stale = 0;
+  for (int k = 0; k < BENCH_ENTITIES; k += 2) {
+    n_stale += find_entity(vat, entity_ids[k]) == nullptr;
+  }
+
+  dbp(log_info, "%d entities: %.1fns/lookup (%lu found), %lu/%d stale ids rejected", BENCH_ENTITIES, elapsed.count() / BENCH_ENTITY_LOOKUPS,
+      (unsigned long)n_found, (unsigned long)n_stale, BENCH_ENTITIES / 2);
+
+  vat->entities.for_each([](int entity_id, Entity *ent) { delete ent; });
+  delete vat;
+}
+
+// Runs the same loop-heavy function on one entity under each engine, taking
+// turns so both see the same heap.  Arithmetic works on immediates, calls
+// reuse their frames and ranges are counted through, so none of the loops
+// should allocate any nodes.
+void bench_engine_func(Entity *ent, EvalContext *context, std::string func_name) {
+  Engine old_engine = engine;
+  std::vector<Engine> engines = {Engine::Tree, Engine::Bytecode};
+  std::vector<std::chrono::duration<double, std::nano>> elapsed(engines.size());
+  std::vector<int64_t> results(engines.size());
+  std::vector<u64> allocations(engines.size());
+
+  for (int k = 0; k < BENCH_COUNT_RUNS; ++k) {
+    for (int e = 0; e < engines.size(); ++e) {
+      engine = engines[e];
+
+      u64 start_allocations = ast_allocations;
+      auto start = std::chrono::steady_clock::now();
+      auto res = eval_func_local(context, ent, intern_method(func_name), {make_number_value(BENCH_COUNT_LOOPS)});
+      elapsed[e] += std::chrono::steady_clock::now() - start;
+      allocations[e] += ast_allocations - start_allocations;
+
+      results[e] = value_number(res);
+    }
+  }
+
+  engine = old_engine;
+
+  double tree_ns = elapsed[0].count() / ((double)BENCH_COUNT_RUNS * BENCH_COUNT_LOOPS);
+  for (int e = 0; e < engines.size(); ++e) {
+    double ns = elapsed[e].count() / ((double)BENCH_COUNT_RUNS * BENCH_COUNT_LOOPS);
+    double allocs = allocations[e] / ((double)BENCH_COUNT_RUNS * BENCH_COUNT_LOOPS);
+    dbp(log_info, "%s engine: %s(%d) = %ld, %.1fns/iteration, speedup %.2fx, %.2f allocations/iteration",
+        engines[e] == Engine::Tree ? "tree" : "bytecode", func_name.c_str(), BENCH_COUNT_LOOPS, (long)results[e], ns, tree_ns / ns, allocs);
+  }
+}
+
+void bench_engines(EntityDef *entity_def) {
+  Vat *vat = create_vat(this_pleroma_node);
+
+  EvalContext context;
+  start_context(&context, this_pleroma_node, vat, entity_def->module, nullptr);
+  Entity *ent = create_entity(&context, entity_def, false);
+
+  bench_engine_func(ent, &context, "count");
+  bench_engine_func(ent, &context, "calls");
+  bench_engine_func(ent, &context, "ranges");
+}
+
+void run_bench(PleromaArgs pargs) {
+  this_pleroma_node = new PleromaNode;
+
+  HylicModule *program = load_file("bench", pargs.program_path);
+
+  auto entity_def = program->entity_defs.find(pargs.entity_name);
+  if (entity_def == program->entity_defs.end()) {
+    panic("Failed to find bench entity " + pargs.entity_name);
+  }
+
+  int max_burners = pargs.burners > 0 ? pargs.burners : default_burner_count();
+
+  std::vector<int> burner_counts;
+  for (int k = 1; k < max_burners; k *= 2) {
+    burner_counts.push_back(k);
+  }
+  burner_counts.push_back(max_burners);
+
+  dbp(log_info, "Bench: %d vats x %d steps, %s engine", pargs.bench_vats, pargs.bench_steps, pargs.engine.c_str());
+
+  double base_rate = 0;
+  for (auto n_burners : burner_counts) {
+    SchedulerStats stats;
+    double secs = bench_burners((EntityDef *)entity_def->second, n_burners, pargs.bench_vats, pargs.bench_steps, &stats);
+    double rate = stats.messages / secs;
+
+    if (base_rate == 0) {
+      base_rate = rate;
+    }
+
+    dbp(log_info, "%d burners: %lu msgs in %.3fs, %.0f msgs/s, speedup %.2fx, %lu budget hits", n_burners, (unsigned long)stats.messages,
+        secs, rate, rate / base_rate, (unsigned long)stats.budget_hits);
+  }
+
+  bench_idle((EntityDef *)entity_def->second, max_burners, pargs.bench_idle_vats);
+  bench_timers((EntityDef *)entity_def->second, max_burners, pargs.bench_timers);
+  bench_promises();
+  bench_entities();
+  bench_engines((EntityDef *)entity_def->second);
+}
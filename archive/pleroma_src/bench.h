@@ -0,0 +1,7 @@
+#pragma once
+
+#include "args.h"
+
+// Spins up vats running the bench program and reports message throughput for
+// an increasing number of burners
+void run_bench(PleromaArgs pargs);
@@ -10,6 +10,7 @@
 
 SDL_Renderer *renderer;
 std::string command_text;
+const MethodId SUBSCRIBE_IRQ_METHOD = method_hash("subscribe-irq");
 
 // Base
 struct MouseState {
@@ -111,7 +112,7 @@ void render() {
   SDL_RenderPresent(renderer);
 }
 
-AstNode *amoeba_init(EvalContext *context, std::vector<AstNode *> args) {
+Value amoeba_init(EvalContext *context, std::vector<Value> args) {
   if (SDL_Init(SDL_INIT_VIDEO) < 0) {
     panic("Failed to initialize video system.");
   }
@@ -120,8 +121,7 @@ AstNode *amoeba_init(EvalContext *context, std::vector<AstNode *> args) {
     panic("Failed to initialize TTF system.");
   }
 
-  EntityRefNode* rfn = (EntityRefNode*)cfs(context).entity->data["mnd"];
-  eval_message_node(context, rfn, CommMode::Async, "subscribe-irq", {make_number(1)});
+  eval_message_node(context, entity_field(cfs(context).entity, "mnd"), CommMode::Async, SUBSCRIBE_IRQ_METHOD, {make_number_value(1)});
 
   auto window = SDL_CreateWindow("SDL2 Window", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, 680, 480, SDL_WINDOW_FULLSCREEN_DESKTOP);
   renderer = SDL_CreateRenderer(window, -1, 0);
@@ -132,10 +132,10 @@ AstNode *amoeba_init(EvalContext *context, std::vector<AstNode *> args) {
 
   render();
 
-  return make_number(0);
+  return make_number_value(0);
 }
 
-AstNode *amoeba_super_window(EvalContext *context, std::vector<AstNode *> args) {
+Value amoeba_super_window(EvalContext *context, std::vector<Value> args) {
   AmoebaWindow *window = new AmoebaWindow;
   window->window_id = base_window_id;
   base_window_id++;
@@ -147,50 +147,48 @@ AstNode *amoeba_super_window(EvalContext *context, std::vector<AstNode *> args)
   refresh_window(window);
 
   auto env = eval(context, make_create_entity("AmoebaWindow", false));
-  auto ent_ref = (EntityRefNode*)env;
-
-  context->vat->entities[ent_ref->entity_id]->data["window-id"] = make_number(window->window_id);
+  entity_field(find_entity(context->vat, env.ref.entity_id), "window-id") = make_number_value(window->window_id);
 
   return env;
 }
 
-AstNode *amoeba_close(EvalContext *context, std::vector<AstNode *> args) {
+Value amoeba_close(EvalContext *context, std::vector<Value> args) {
   SDL_Delay(10000);
   //SDL_DestroyWindow();
   SDL_Quit();
-  return make_number(0);
+  return make_number_value(0);
 }
 
-AstNode *amoeba_create(EvalContext *context, std::vector<AstNode *> args) {
-  return make_number(0);
+Value amoeba_create(EvalContext *context, std::vector<Value> args) {
+  return make_number_value(0);
 }
 
-AstNode *super_window_create(EvalContext *context, std::vector<AstNode *> args) {
-  return make_number(0);
+Value super_window_create(EvalContext *context, std::vector<Value> args) {
+  return make_number_value(0);
 }
 
-AstNode *super_window_close(EvalContext *context, std::vector<AstNode *> args) {
-  return make_number(0);
+Value super_window_close(EvalContext *context, std::vector<Value> args) {
+  return make_number_value(0);
 }
 
-AstNode *super_window_write(EvalContext *context, std::vector<AstNode *> args) {
+Value super_window_write(EvalContext *context, std::vector<Value> args) {
 
-  auto window_id = ((NumberNode*)cfs(context).entity->data["window-id"])->value;
+  auto window_id = value_number(entity_field(cfs(context).entity, "window-id"));
 
   drawText(windows[window_id], "test", 24, 0, 0, 255, 255, 255, 0, 0, 0);
 
   refresh_window(windows[window_id]);
 
-  return make_number(0);
+  return make_number_value(0);
 }
 
-AstNode *amoeba_write(EvalContext *context, std::vector<AstNode *> args) {
+Value amoeba_write(EvalContext *context, std::vector<Value> args) {
 
-  return make_number(0);
+  return make_number_value(0);
 }
 
-AstNode *amoeba_handle_input(EvalContext *context, std::vector<AstNode *> args) {
-  auto key_val = ((NumberNode*)args[0])->value;
+Value amoeba_handle_input(EvalContext *context, std::vector<Value> args) {
+  auto key_val = value_number(args[0]);
 
   printf("got key %ld\n", key_val);
 
@@ -209,7 +207,7 @@ AstNode *amoeba_handle_input(EvalContext *context, std::vector<AstNode *> args)
 
   render();
 
-  return make_number(0);
+  return make_number_value(0);
 }
 
 std::map<std::string, AstNode *> load_amoeba() {
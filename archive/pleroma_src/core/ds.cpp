@@ -6,32 +6,32 @@
 #include <string>
 #include <vector>
 
-AstNode *hashmap_readline(EvalContext *context, std::vector<AstNode *> args) {
+Value hashmap_readline(EvalContext *context, std::vector<Value> args) {
 
-  return make_string("blah");
+  return make_object_value(make_string("blah"));
 }
 
-AstNode *hashmap_create(EvalContext *context, std::vector<AstNode *> args) {
-  return make_number(0);
+Value hashmap_create(EvalContext *context, std::vector<Value> args) {
+  return make_number_value(0);
 }
 
-AstNode *hashmap_get(EvalContext *context, std::vector<AstNode *> args) {
+Value hashmap_get(EvalContext *context, std::vector<Value> args) {
 
-  std::string sarg = ((StringNode *)args[0])->value;
+  std::string sarg = value_ncast<StringNode *>(args[0], AstNodeType::StringNode)->value;
 
-  std::string retval = ((StringNode*)cfs(context).entity->_kdata[sarg])->value;
+  std::string retval = safe_ncast<StringNode *>(cfs(context).entity->_kdata[sarg], AstNodeType::StringNode)->value;
 
 
-  return make_string(retval);
+  return make_object_value(make_string(retval));
 }
 
-AstNode *hashmap_set(EvalContext *context, std::vector<AstNode *> args) {
+Value hashmap_set(EvalContext *context, std::vector<Value> args) {
 
-  std::string sarg = ((StringNode*) args[0])->value;
+  std::string sarg = value_ncast<StringNode *>(args[0], AstNodeType::StringNode)->value;
 
-  cfs(context).entity->_kdata[sarg] = args[1];
+  cfs(context).entity->_kdata[sarg] = value_ncast<StringNode *>(args[1], AstNodeType::StringNode);
 
-  return make_nop();
+  return make_nop_value();
 }
 
 std::map<std::string, AstNode*> load_ds() {
@@ -6,8 +6,8 @@
 #include "../hylic_ast.h"
 #include "../hylic_eval.h"
 
-FuncStmt *setup_direct_call(AstNode *(*foreign_func)(EvalContext *,
-                                                     std::vector<AstNode *>),
+FuncStmt *setup_direct_call(Value (*foreign_func)(EvalContext *,
+                                                  std::vector<Value>),
                             std::string name, std::vector<std::string> args,
                             std::vector<CType *> arg_types, CType ctype);
 
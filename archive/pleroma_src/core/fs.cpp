@@ -14,19 +14,19 @@
 
 extern std::map<std::string, AstNode *> kernel_map;
 
-AstNode *fs_readfile(EvalContext *context, std::vector<AstNode *> args) {
+Value fs_readfile(EvalContext *context, std::vector<Value> args) {
 
-  StringNode* fname = (StringNode*) args[0];
+  auto fname = value_ncast<StringNode *>(args[0], AstNodeType::StringNode);
 
   std::ifstream t(fname->value);
   std::stringstream buffer;
   buffer << t.rdbuf();
 
-  return make_string(buffer.str());
+  return make_object_value(make_string(buffer.str()));
 }
 
-AstNode *fs_create(EvalContext *context, std::vector<AstNode *> args) {
-  return make_number(0);
+Value fs_create(EvalContext *context, std::vector<Value> args) {
+  return make_number_value(0);
 }
 
 void load_fs() {
@@ -6,42 +6,41 @@
 #include <string>
 #include <vector>
 
-AstNode *io_print(EvalContext *context, std::vector<AstNode *> args) {
+Value io_print(EvalContext *context, std::vector<Value> args) {
 
-  auto pval = args[0];
+  auto &pval = args[0];
 
-  if (pval->type == AstNodeType::StringNode) {
-    printf("%s\n", ((StringNode *)pval)->value.c_str());
+  if (pval.tag == ValueTag::Object && pval.object->type == AstNodeType::StringNode) {
+    printf("%s\n", ((StringNode *)pval.object)->value.c_str());
   }
 
-  if (pval->type == AstNodeType::NumberNode) {
-    printf("%ld\n", ((NumberNode *)pval)->value);
+  if (pval.tag == ValueTag::Number) {
+    printf("%ld\n", pval.number);
   }
 
-  if (pval->type == AstNodeType::ListNode) {
-    printf("%ld\n", ((NumberNode *)pval)->value);
+  if (pval.tag == ValueTag::Object && pval.object->type == AstNodeType::ListNode) {
+    printf("%s\n", stringify_value(pval).c_str());
   }
 
-  if (pval->type == AstNodeType::EntityRefNode) {
-    auto eref = (EntityRefNode *)pval;
-    printf("EntityRef(%d, %d, %d)\n", eref->node_id, eref->vat_id,
-           eref->entity_id);
+  if (pval.tag == ValueTag::EntityRef) {
+    printf("EntityRef(%d, %d, %d)\n", pval.node_id, pval.ref.vat_id,
+           pval.ref.entity_id);
   }
 
-  return make_number(0);
+  return make_number_value(0);
 }
 
-AstNode *io_readline(EvalContext *context, std::vector<AstNode *> args) {
+Value io_readline(EvalContext *context, std::vector<Value> args) {
 
   std::string user_input;
 
   std::getline(std::cin, user_input);
 
-  return make_string(user_input);
+  return make_object_value(make_string(user_input));
 }
 
-AstNode *io_create(EvalContext *context, std::vector<AstNode *> args) {
-  return make_number(0);
+Value io_create(EvalContext *context, std::vector<Value> args) {
+  return make_number_value(0);
 }
 
 std::map<std::string, AstNode*> load_io() {
@@ -29,6 +29,9 @@ std::map<std::string, HylicModule*> programs;
 
 std::map<int, std::vector<EntityRefNode*>> irq_subscriptions;
 
+const MethodId CREATE_VAT_METHOD = method_hash("create-vat");
+const MethodId HANDLE_INPUT_METHOD = method_hash("handle-input");
+
 std::mutex node_mtx;
 std::vector<PleromaNode*> nodes;
 
@@ -102,9 +105,9 @@ EntityRefNode* get_system_entity_ref(std::string sys_name, std::string ent_name)
   return get_entity_ref(ent->second);
 }
 
-AstNode *monad_new_vat(EvalContext *context, std::vector<AstNode *> args) {
-  std::string program_name = ((StringNode *)args[0])->value;
-  std::string ent_name = ((StringNode *)args[1])->value;
+Value monad_new_vat(EvalContext *context, std::vector<Value> args) {
+  std::string program_name = value_ncast<StringNode *>(args[0], AstNodeType::StringNode)->value;
+  std::string ent_name = value_ncast<StringNode *>(args[1], AstNodeType::StringNode)->value;
 
   monad_log("Received new vat request (" + program_name + " / " + ent_name + ")");
 
@@ -114,7 +117,7 @@ AstNode *monad_new_vat(EvalContext *context, std::vector<AstNode *> args) {
     printf("Sending create-vat to %d %d %d\n", sched_node->nodeman_addr.node_id, sched_node->nodeman_addr.vat_id, sched_node->nodeman_addr.entity_id);
     //FIXME hardcoded nodeman
 
-    auto prom = eval_message_node(context, (EntityRefNode *)make_entity_ref(sched_node->nodeman_addr.node_id, sched_node->nodeman_addr.vat_id, sched_node->nodeman_addr.entity_id), CommMode::Async, "create-vat", args);
+    auto prom = eval_message_node(context, make_entity_ref_value(sched_node->nodeman_addr.node_id, sched_node->nodeman_addr.vat_id, sched_node->nodeman_addr.entity_id), CommMode::Async, CREATE_VAT_METHOD, args);
 
     //eval(context, make_assignment(make_symbol("nodemanref"), eval_val));
     //auto eref = (EntityRefNode*)context->vat->promises[eval_val->promise_id].results[0];
@@ -122,7 +125,7 @@ AstNode *monad_new_vat(EvalContext *context, std::vector<AstNode *> args) {
     // return eval_val;
     // context->vat->promises[eval_val->promise_id].callback =
     // (PromiseResNode*)make_promise_resolution_node("nodemanref",
-    // {make_return(make_symbol("nodemanref"))}); return make_nop();
+    // {make_return(make_symbol("nodemanref"))}); return make_nop_value();
     // IMPORTANT FIXME
     //return make_entity_ref(0, 2, 0);
     //printf("inside call %s\n", ast_type_to_string(prom->type).c_str());
@@ -134,46 +137,46 @@ AstNode *monad_new_vat(EvalContext *context, std::vector<AstNode *> args) {
   assert(false);
 }
 
-AstNode *monad_request_far_entity(EvalContext *context, std::vector<AstNode*> args) {
+Value monad_request_far_entity(EvalContext *context, std::vector<Value> args) {
 
   CType c;
   c.basetype = PType::Entity;
   c.dtype = DType::Far;
-  c.entity_name = ((EntityRefNode*)args[0])->ctype.entity_name;
+  c.entity_name = value_ncast<EntityRefNode *>(args[0], AstNodeType::EntityRefNode)->ctype.entity_name;
 
   std::vector<std::string> splimp = split_import(c.entity_name);
 
   auto io_ent = get_system_entity_ref(splimp[0], splimp[1]);
   monad_log("Got far request for " + c.entity_name + ", resolved to " + entity_ref_str(io_ent));
 
-  return io_ent;
+  return make_value(io_ent);
 }
 
-AstNode *monad_irq_handler(EvalContext *context, std::vector<AstNode*> args) {
+Value monad_irq_handler(EvalContext *context, std::vector<Value> args) {
   monad_log("got IRQ, sending out IRQ to subscribers");
-  NumberNode *irq_num = safe_ncast<NumberNode *>(args[0], AstNodeType::NumberNode);
-  NumberNode *irq_data = safe_ncast<NumberNode *>(args[1], AstNodeType::NumberNode);
+  auto irq_num = value_number(args[0]);
+  auto irq_data = value_number(args[1]);
 
-  for (auto &k : irq_subscriptions[irq_num->value]) {
+  for (auto &k : irq_subscriptions[irq_num]) {
     printf("Sending to \n");
-    eval_message_node(context, k, CommMode::Async, "handle-input", {make_number(irq_data->value)});
+    eval_message_node(context, make_value(k), CommMode::Async, HANDLE_INPUT_METHOD, {make_number_value(irq_data)});
     printf("SEnt to \n");
   }
-  return make_number(0);
+  return make_number_value(0);
 }
 
-AstNode *monad_subscribe_irq(EvalContext *context, std::vector<AstNode *> args) {
-  NumberNode* irq_num = safe_ncast<NumberNode*>(args[0], AstNodeType::NumberNode);
-  printf("Registered number %d\n", irq_num->value);
+Value monad_subscribe_irq(EvalContext *context, std::vector<Value> args) {
+  auto irq_num = value_number(args[0]);
+  printf("Registered number %ld\n", (long)irq_num);
   // FIXME
-  irq_subscriptions[irq_num->value].push_back((EntityRefNode*)make_entity_ref(0, 3, 0));
-  return make_number(0);
+  irq_subscriptions[irq_num].push_back((EntityRefNode*)make_entity_ref(0, 3, 0));
+  return make_number_value(0);
 }
 
-AstNode *monad_start_program(EvalContext *context, std::vector<AstNode*> args) {
+Value monad_start_program(EvalContext *context, std::vector<Value> args) {
 
-  std::string program_name = ((StringNode*)args[0])->value;;
-  std::string ent_name = ((StringNode *)args[1])->value;
+  std::string program_name = value_ncast<StringNode *>(args[0], AstNodeType::StringNode)->value;;
+  std::string ent_name = value_ncast<StringNode *>(args[1], AstNodeType::StringNode)->value;
 
   monad_log("Starting program: " + program_name + " / " + ent_name);
 
@@ -184,19 +187,19 @@ AstNode *monad_start_program(EvalContext *context, std::vector<AstNode*> args) {
   auto eref = monad_new_vat(context, args);
   // FIXME: hardcoded NodeMan address
 
-  auto finaly = eval_message_node(context, eref, CommMode::Async, "main", {make_number(0)});
+  auto finaly = eval_message_node(context, eref, CommMode::Async, MAIN_METHOD, {make_number_value(0)});
   return finaly;
 }
 
-AstNode *monad_n_programs(EvalContext *context, std::vector<AstNode *> args) {
-  return make_string(std::to_string(n_running_programs));
+Value monad_n_programs(EvalContext *context, std::vector<Value> args) {
+  return make_object_value(make_string(std::to_string(n_running_programs)));
 }
 
-AstNode *monad_create(EvalContext *context, std::vector<AstNode *> args) {
-  return make_number(0);
+Value monad_create(EvalContext *context, std::vector<Value> args) {
+  return make_number_value(0);
 }
 
-AstNode *monad_hello(EvalContext *context, std::vector<AstNode *> args) {
+Value monad_hello(EvalContext *context, std::vector<Value> args) {
   monad_log("Hello");
 
   system_entities["monad"]["Monad"] = cfs(context).entity;
@@ -212,16 +215,16 @@ AstNode *monad_hello(EvalContext *context, std::vector<AstNode *> args) {
   load_system_entity(context, "zeno", "ZenoMaster");
 
   //eval_message_node(context, eref, CommMode::Sync, "print", {make_string("hi")});
-  return make_number(0);
+  return make_number_value(0);
 }
 
-AstNode *nodeman_create(EvalContext *context, std::vector<AstNode *> args) {
-  return make_number(0);
+Value nodeman_create(EvalContext *context, std::vector<Value> args) {
+  return make_number_value(0);
 }
 
-AstNode *nodeman_create_vat(EvalContext *context, std::vector<AstNode *> args) {
-  std::string program_name = ((StringNode *)args[0])->value;
-  std::string ent_name = ((StringNode *)args[1])->value;
+Value nodeman_create_vat(EvalContext *context, std::vector<Value> args) {
+  std::string program_name = value_ncast<StringNode *>(args[0], AstNodeType::StringNode)->value;
+  std::string ent_name = value_ncast<StringNode *>(args[1], AstNodeType::StringNode)->value;
 
   nodeman_log("Received create vat request (" + program_name + " / " + ent_name + ")");
 
@@ -231,7 +234,7 @@ AstNode *nodeman_create_vat(EvalContext *context, std::vector<AstNode *> args) {
   io_ent->module_scope = io_ent->entity_def->module;
 
   nodeman_log("Created new vat (" + program_name + " / " + ent_name + ") @ (" + std::to_string(io_ent->address.node_id) + ", " + std::to_string(io_ent->address.vat_id) + ", " + std::to_string(io_ent->address.entity_id) + ")");
-  return get_entity_ref(io_ent);
+  return make_value(get_entity_ref(io_ent));
 }
 
 void load_kernel() {
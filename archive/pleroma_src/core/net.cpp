@@ -21,23 +21,24 @@ int opt = 1;
 int addrlen = sizeof(address);
 char buffer[1024] = {0};
 
+const MethodId NEXT_METHOD = method_hash("next");
+const MethodId RETURN_HTTP_RESULT_METHOD = method_hash("return-http-result");
+
 // Host -> Entity
 std::map<std::string, std::tuple<EntityRefNode *, std::string>> host_entity_lookup;
 
-AstNode *net_return_http_result(EvalContext *context, std::vector<AstNode *> args) {
-  assert(args[0]->type == AstNodeType::StringNode);
-
-  auto res_str = (StringNode *)args[0];
+Value net_return_http_result(EvalContext *context, std::vector<Value> args) {
+  auto res_str = value_ncast<StringNode *>(args[0], AstNodeType::StringNode);
   printf("calling return result %s\n", res_str->value.c_str());
   send(new_socket, res_str->value.c_str(), strlen(res_str->value.c_str()), 0);
   close(new_socket);
 
-  eval_message_node(context, (EntityRefNode *)make_entity_ref(-1, -1, -1), CommMode::Async, "next", {});
+  eval_message_node(context, make_entity_ref_value(-1, -1, -1), CommMode::Async, NEXT_METHOD, {});
 
-  return make_nop();
+  return make_nop_value();
 }
 
-AstNode *net_start(EvalContext *context, std::vector<AstNode *> args) {
+Value net_start(EvalContext *context, std::vector<Value> args) {
 
   // Creating socket file descriptor
   if ((server_fd = socket(AF_INET, SOCK_STREAM, 0)) == 0) {
@@ -64,18 +65,18 @@ AstNode *net_start(EvalContext *context, std::vector<AstNode *> args) {
     exit(EXIT_FAILURE);
   }
 
-  std::string hostname = ((StringNode *)args[0])->value;
-  auto entity_ref = ((EntityRefNode *)args[1]);
-  std::string callback = ((StringNode *)args[2])->value;
+  std::string hostname = value_ncast<StringNode *>(args[0], AstNodeType::StringNode)->value;
+  auto entity_ref = args[1];
+  std::string callback = value_ncast<StringNode *>(args[2], AstNodeType::StringNode)->value;
 
   printf("registered %s\n", hostname.c_str());
   host_entity_lookup[hostname] =
-      std::make_tuple((EntityRefNode *)make_entity_ref(entity_ref->node_id, entity_ref->vat_id, entity_ref->entity_id), callback);
+      std::make_tuple((EntityRefNode *)make_entity_ref(entity_ref.node_id, entity_ref.ref.vat_id, entity_ref.ref.entity_id), callback);
 
-  return make_number(0);
+  return make_number_value(0);
 }
 
-AstNode *net_next(EvalContext *context, std::vector<AstNode *> args) {
+Value net_next(EvalContext *context, std::vector<Value> args) {
   if ((new_socket = accept(server_fd, (struct sockaddr *)&address, (socklen_t *)&addrlen), SOCK_NONBLOCK) < 0) {
     perror("accept");
     exit(EXIT_FAILURE);
@@ -108,14 +109,14 @@ AstNode *net_next(EvalContext *context, std::vector<AstNode *> args) {
     std::string rsp404 = "HTTP/1.1 404 Not Found";
     send(new_socket, rsp404.c_str(), strlen(rsp404.c_str()), 0);
     close(new_socket);
-    return make_number(0);
+    return make_number_value(0);
   }
   auto host_ref = host_entity_lookup[hostname];
   // AstNode* res = eval_message_node(context, (EntityRefNode*)make_entity_ref(0, 0, 2), MessageDistance::Local, CommMode::Sync, "test",
   // {make_string(buffer)});
-  PromiseNode *res = (PromiseNode *)eval_message_node(context, std::get<0>(host_ref), CommMode::Async, std::get<1>(host_ref), {make_string(verb), make_string(path)});
+  auto res = eval_message_node(context, make_value(std::get<0>(host_ref)), CommMode::Async, method_hash(std::get<1>(host_ref).c_str()), {make_object_value(make_string(verb)), make_object_value(make_string(path))});
 
-  eval_message_node(context, make_self(), CommMode::Async, "return-http-result", {res});
+  eval_message_node(context, eval(context, make_self()), CommMode::Async, RETURN_HTTP_RESULT_METHOD, {res});
   //{make_message_node(make_self(), "return-http-result", CommMode::Async, {res})}));
   // context->vat->promises[res->promise_id].callbacks.push_back((PromiseResNode *)make_promise_resolution_node("anon",
   // {make_message_node(make_self(), "return-http-result", CommMode::Async, {res})}));
@@ -123,10 +124,10 @@ AstNode *net_next(EvalContext *context, std::vector<AstNode *> args) {
   //context->vat->promises[res->promise_id].callbacks.push_back((PromiseResNode *)make_promise_resolution_node(
   //    "anon", {make_message_node(make_entity_ref(0, 0, 1), "print", CommMode::Async, {make_string("blah")})}));
 
-  return make_number(0);
+  return make_number_value(0);
 }
 
-AstNode *net_create(EvalContext *context, std::vector<AstNode *> args) { return make_number(0); }
+Value net_create(EvalContext *context, std::vector<Value> args) { return make_number_value(0); }
 
 std::map<std::string, AstNode *> load_net() {
   std::map<std::string, FuncStmt *> functions;
@@ -10,34 +10,36 @@
 #include <vector>
 
 const u64 chunk_size = 4096;
+const MethodId CHECKOUT_METHOD = method_hash("checkout");
+const MethodId ASSEMBLE_CHUNKS_METHOD = method_hash("assemble-chunks");
 
 // Filename -> node ID -> chunk names
 std::map<std::string, std::map<int, std::vector<std::string>>> chunk_map;
 
 // ZenoMaster
-AstNode *zeno_create(EvalContext *context, std::vector<AstNode *> args) {
+Value zeno_create(EvalContext *context, std::vector<Value> args) {
 
   chunk_map["example.dat"][0].push_back("hd/example-0.dat");
   chunk_map["example.dat"][0].push_back("hd/example-1.dat");
 
-  return make_number(0);
+  return make_number_value(0);
 }
 
-AstNode *zeno_upload(EvalContext *context, std::vector<AstNode *> args) {
+Value zeno_upload(EvalContext *context, std::vector<Value> args) {
 
-  auto filename = safe_ncast<StringNode*>(args[0], AstNodeType::StringNode)->value;
-  auto contents = safe_ncast<StringNode *>(args[1], AstNodeType::StringNode)->value;
+  auto filename = value_ncast<StringNode *>(args[0], AstNodeType::StringNode)->value;
+  auto contents = value_ncast<StringNode *>(args[1], AstNodeType::StringNode)->value;
 
   write_file("hd/" + filename + "-0.dat", contents);
 
   chunk_map[filename][0].push_back("hd/" + filename + "-0.dat");
 
-  return make_number(0);
+  return make_number_value(0);
 }
 
-AstNode *zeno_checkout(EvalContext *context, std::vector<AstNode *> args) {
+Value zeno_checkout(EvalContext *context, std::vector<Value> args) {
 
-  std::string file_id = extract_string(args[0]);
+  std::string file_id = value_ncast<StringNode *>(args[0], AstNodeType::StringNode)->value;
 
   CType *str_type = new CType;
   str_type->basetype = PType::str;
@@ -49,7 +51,7 @@ AstNode *zeno_checkout(EvalContext *context, std::vector<AstNode *> args) {
     chunk_locs.push_back(make_string(k));
   }
 
-  return make_list(chunk_locs,  str_type);
+  return make_object_value(make_list(chunk_locs,  str_type));
 }
 
 // ZenoNode
@@ -80,17 +82,17 @@ void write_file(std::string filename, std::string contents) {
   wf.close();
 }
 
-AstNode *zfile_create(EvalContext *context, std::vector<AstNode *> args) {
-  return make_number(0);
+Value zfile_create(EvalContext *context, std::vector<Value> args) {
+  return make_number_value(0);
 }
 
-AstNode *zfile_get_chunks(EvalContext *context, std::vector<AstNode *> args) {
+Value zfile_get_chunks(EvalContext *context, std::vector<Value> args) {
   // return make_message_node(make_symbol("zm"), std::string function_name, CommMode comm_mode, std::vector<AstNode *> args)
-  return make_number(0);
+  return make_number_value(0);
 }
 
-AstNode *zfile_assemble_chunks(EvalContext *context, std::vector<AstNode *> args) {
-  auto chunk_list = (ListNode *)args[0];
+Value zfile_assemble_chunks(EvalContext *context, std::vector<Value> args) {
+  auto chunk_list = value_ncast<ListNode *>(args[0], AstNodeType::ListNode);
 
   std::string lol;
   for (int i = 0; i < chunk_list->list.size(); ++i) {
@@ -99,19 +101,19 @@ AstNode *zfile_assemble_chunks(EvalContext *context, std::vector<AstNode *> args
     lol += read_local_file(chunk_name);
   }
 
-  return make_string(lol);
+  return make_object_value(make_string(lol));
 }
 
-AstNode *zfile_test(EvalContext *context, std::vector<AstNode *> args) {
+Value zfile_test(EvalContext *context, std::vector<Value> args) {
 
-  auto m1 = eval_message_node(context, cfs(context).entity->data["zm"], CommMode::Async, "checkout", {args[0]});
+  auto m1 = eval_message_node(context, entity_field(cfs(context).entity, "zm"), CommMode::Async, CHECKOUT_METHOD, {args[0]});
 
   CType *str_type = new CType;
   str_type->basetype = PType::str;
   str_type->dtype = DType::Local;
 
   auto slist = make_list({make_string("example-0.dat"), make_string("example-1.dat")}, str_type);
-  auto m2 = eval_message_node(context, make_entity_ref(-1, -1, -1), CommMode::Sync, "assemble-chunks", {slist});
+  auto m2 = eval_message_node(context, make_entity_ref_value(-1, -1, -1), CommMode::Sync, ASSEMBLE_CHUNKS_METHOD, {make_object_value(slist)});
 
   return m2;
 }
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+// A vector whose copies share storage until one of them writes.  Reads go
+// through the shared storage; set() and push_back() first take a private
+// copy if anyone else still holds it.  Lists use it so a literal or a list
+// sent in a message can be handed out without copying its elements.
+//
+// The refcount is atomic, so copies may live on different burners.  A
+// writer only ever detaches when it isn't the sole owner, so two racing
+// writers each end up with their own copy.
+template <typename T>
+struct CowVector {
+  std::shared_ptr<std::vector<T>> items;
+
+  CowVector() : items(std::make_shared<std::vector<T>>()) {}
+  CowVector(std::vector<T> values) : items(std::make_shared<std::vector<T>>(std::move(values))) {}
+  CowVector(std::initializer_list<T> values) : items(std::make_shared<std::vector<T>>(values)) {}
+
+  size_t size() const { return items->size(); }
+  bool empty() const { return items->empty(); }
+
+  const T &operator[](size_t i) const { return (*items)[i]; }
+  typename std::vector<T>::const_iterator begin() const { return items->cbegin(); }
+  typename std::vector<T>::const_iterator end() const { return items->cend(); }
+
+  void set(size_t i, T value) {
+    detach();
+    (*items)[i] = std::move(value);
+  }
+
+  void push_back(T value) {
+    detach();
+    items->push_back(std::move(value));
+  }
+
+  bool shared() const { return items.use_count() > 1; }
+
+  void detach() {
+    if (shared()) {
+      items = std::make_shared<std::vector<T>>(*items);
+    }
+  }
+};
@@ -3,26 +3,73 @@
 #include "hylic_eval.h"
 #include "gc.h"
 
-void mark(AstNode* root) {
+#include <set>
+
+void mark(AstNode* root, std::set<int> *held_promises) {
   root->marked = true;
 
   switch (root->type) {
     case AstNodeType::ListNode:{
       auto tmp_lst = safe_ncast<ListNode*>(root, AstNodeType::ListNode);
       for (auto &k : tmp_lst->list) {
-        mark(k);
+        mark(k, held_promises);
+      }
+    } break;
+    case AstNodeType::RopeNode:{
+      // Appending in a loop builds a left-deep chain, walk it without recursing
+      auto rope = (RopeNode *)root;
+      while (true) {
+        rope->marked = true;
+        mark(rope->right, held_promises);
+        if (rope->left->type != AstNodeType::RopeNode) {
+          mark(rope->left, held_promises);
+          break;
+        }
+        rope = (RopeNode *)rope->left;
       }
     } break;
+    case AstNodeType::PromiseNode:{
+      held_promises->insert(((PromiseNode *)root)->promise_id);
+    } break;
+  }
+}
+
+void mark_value(const Value &value, std::set<int> *held_promises) {
+  if (value.tag == ValueTag::Object) {
+    mark(value.object, held_promises);
+  } else if (value.tag == ValueTag::Promise) {
+    held_promises->insert(value.promise_id);
   }
 }
 
 void run_gc(Vat *vat) {
 
   // Mark
-  for (auto &[ent_k, ent_v] : vat->entities) {
-    ent_v->marked = true;
-    for (auto &[_, v] : ent_v->data) {
-      mark(v);
+  std::set<int> held_promises;
+  vat->entities.for_each([&](int entity_id, Entity *ent) {
+    ent->marked = true;
+    for (auto &v : ent->data) {
+      mark_value(v, &held_promises);
+    }
+  });
+
+  // Results of the promises they hold, which may hold further promises
+  std::vector<int> pending(held_promises.begin(), held_promises.end());
+  while (!pending.empty()) {
+    PromiseResult *promise = vat->promises.find(pending.back());
+    pending.pop_back();
+    if (!promise) {
+      continue;
+    }
+
+    std::set<int> found;
+    for (auto &v : promise->results) {
+      mark_value(v, &found);
+    }
+    for (auto promise_id : found) {
+      if (held_promises.insert(promise_id).second) {
+        pending.push_back(promise_id);
+      }
     }
   }
 
@@ -44,4 +91,10 @@ void run_gc(Vat *vat) {
       it++;
     }
   }
+
+  // Settled promises are only kept around for entities still holding them,
+  // nothing else outlives the handler that made it
+  vat->promises.erase_if([&](int promise_id, PromiseResult &promise) {
+    return (promise.resolved || promise.rejected) && held_promises.find(promise_id) == held_promises.end();
+  });
 }
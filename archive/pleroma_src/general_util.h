@@ -17,7 +17,7 @@ enum LogLevel {
 void dbp(int, const char * format, ...);
 
 #define panic(x) _panic(x, __FILE_NAME__, __LINE__, __func__)
-void _panic(std::string msg, std::string file_name, int line_no, std::string func_name);
+[[noreturn]] void _panic(std::string msg, std::string file_name, int line_no, std::string func_name);
 
 template <class T>
 bool in(T v, std::vector<T> vec) {
@@ -5,6 +5,8 @@
 #include "hylic_ast.h"
 #include "netcode.h"
 
+const MethodId IRQ_HANDLER_METHOD = method_hash("irq-handler");
+
 void start() {
 }
 
@@ -27,15 +29,10 @@ void loop_keyboard() {
       m.src_node_id = -1;
       m.src_vat_id = -1;
       m.src_entity_id = -1;
-      m.function_name = "irq-handler";
-      m.values.push_back((ValueNode*)make_number(1));
-      m.values.push_back((ValueNode *)make_number(event.key.keysym.sym));
-      net_out_queue.enqueue(m);
+      m.method_id = IRQ_HANDLER_METHOD;
+      m.values.push_back(make_number_value(1));
+      m.values.push_back(make_number_value(event.key.keysym.sym));
+      send_net_msg(m);
     }
   }
 }
-
-void loop_timer() {
-  sleep(1);
-  printf("Timer IRQ!\n");
-}
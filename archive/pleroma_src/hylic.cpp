@@ -19,6 +19,9 @@
 #include "hylic_compex.h"
 #include "hylic_eval.h"
 #include "hylic_parse.h"
+#include "hylic_compiler.h"
+#include "hylic_optimise.h"
+#include "hylic_resolve.h"
 #include "hylic_tokenizer.h"
 #include "hylic_typesolver.h"
 #include "general_util.h"
@@ -34,6 +37,9 @@ HylicModule *load_file(std::string program_name, std::string path) {
   program = parse(program_name, stream);
 
   typesolve(program);
+  optimise(program);
+  resolve(program);
+  compile(program);
 
   return program;
 }
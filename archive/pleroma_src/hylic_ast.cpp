@@ -5,6 +5,8 @@
 #include <cassert>
 #include <string>
 
+thread_local u64 ast_allocations = 0;
+
 AstNode *static_nop;
 AstNode *static_true;
 AstNode *static_false;
@@ -32,6 +34,7 @@ std::string ast_type_to_string(AstNodeType t) {
   case AstNodeType::ListNode: return "ListNode";
   case AstNodeType::SymbolNode: return "SymbolNode";
   case AstNodeType::StringNode: return "StringNode";
+  case AstNodeType::RopeNode: return "RopeNode";
   case AstNodeType::CharacterNode: return "CharacterNode";
   case AstNodeType::TupleNode: return "TupleNode";
   case AstNodeType::OperatorExpr: return "OperatorExpr";
@@ -45,6 +48,7 @@ std::string ast_type_to_string(AstNodeType t) {
   case AstNodeType::SelfNode: return "SelfNode";
   case AstNodeType::CommentNode: return "CommentNode";
   case AstNodeType::RangeNode: return "RangeNode";
+  case AstNodeType::FallthroughExpr: return "FallthroughExpr";
   }
   printf("Failed to convert AstNode type to string: %d\n", t);
   assert(false);
@@ -98,6 +102,8 @@ AstNode *make_fallthrough() {
 AstNode *make_boolean_expr(BooleanExpr::Op op, AstNode *expr1, AstNode *expr2) {
   BooleanExpr *exp = new BooleanExpr;
   exp->type = AstNodeType::BooleanExpr;
+  exp->ctype.basetype = PType::boolean;
+  exp->ctype.dtype = DType::Local;
   exp->op = op;
   exp->term1 = expr1;
   exp->term2 = expr2;
@@ -119,9 +125,58 @@ make_match(AstNode *match_expr,
   node->type = AstNodeType::MatchNode;
   node->match_expr = match_expr;
   node->cases = cases;
+  build_match_table(node);
   return node;
 }
 
+void build_match_table(MatchNode *node) {
+  node->default_case = -1;
+  node->table_tag = ValueTag::Empty;
+  node->number_table.clear();
+  node->string_table.clear();
+
+  // Stays Empty if any arm has to be evaluated or the kinds are mixed
+  ValueTag tag = ValueTag::Empty;
+  bool tabled = true;
+  for (int k = 0; k < node->cases.size(); ++k) {
+    auto case_expr = std::get<0>(node->cases[k]);
+
+    if (case_expr->type == AstNodeType::FallthroughExpr) {
+      if (node->default_case == -1) {
+        node->default_case = k;
+      }
+      continue;
+    }
+
+    ValueTag case_tag;
+    if (case_expr->type == AstNodeType::NumberNode) {
+      case_tag = ValueTag::Number;
+      node->number_table.emplace(((NumberNode *)case_expr)->value, k);
+    } else if (case_expr->type == AstNodeType::BooleanNode) {
+      case_tag = ValueTag::Boolean;
+      node->number_table.emplace(((BooleanNode *)case_expr)->value, k);
+    } else if (case_expr->type == AstNodeType::StringNode) {
+      case_tag = ValueTag::Object;
+      node->string_table.emplace(((StringNode *)case_expr)->value, k);
+    } else {
+      tabled = false;
+      continue;
+    }
+
+    if (tag != ValueTag::Empty && tag != case_tag) {
+      tabled = false;
+    }
+    tag = case_tag;
+  }
+
+  if (tabled) {
+    node->table_tag = tag;
+  } else {
+    node->number_table.clear();
+    node->string_table.clear();
+  }
+}
+
 AstNode *make_namespace_access(AstNode* ref, AstNode* field) {
   NamespaceAccess *node = new NamespaceAccess;
   node->type = AstNodeType::NamespaceAccess;
@@ -180,10 +235,48 @@ AstNode *make_string(std::string s) {
   StringNode *node = new StringNode;
   node->type = AstNodeType::StringNode;
   node->ctype.basetype = PType::str;
+  node->ctype.dtype = DType::Local;
   node->value = s;
   return node;
 }
 
+bool is_literal(AstNode *obj) {
+  switch (obj->type) {
+  case AstNodeType::CommentNode:
+  case AstNodeType::NumberNode:
+  case AstNodeType::StringNode:
+  case AstNodeType::Nop:
+  case AstNodeType::TableNode:
+  case AstNodeType::BooleanNode:
+  case AstNodeType::EntityDef:
+  case AstNodeType::EntityRefNode:
+  case AstNodeType::PromiseNode:
+    return true;
+  default:
+    return false;
+  }
+}
+
+AstNode *share_list(ListNode *list) {
+  ListNode *list_node = new ListNode;
+  list_node->type = AstNodeType::ListNode;
+  list_node->elements = list->elements;
+  list_node->list = list->list;
+  list_node->numbers = list->numbers;
+  list_node->ctype = list->ctype;
+  return list_node;
+}
+
+AstNode *make_rope(AstNode *left, AstNode *right) {
+  RopeNode *node = new RopeNode;
+  node->type = AstNodeType::RopeNode;
+  node->ctype.basetype = PType::str;
+  node->left = left;
+  node->right = right;
+  node->length = string_length(left) + string_length(right);
+  return node;
+}
+
 AstNode *make_entity_creation() {}
 
 // Value nodes
@@ -193,11 +286,15 @@ AstNode *make_boolean(bool b) {
     BooleanNode *true_node = new BooleanNode;
     true_node->type = AstNodeType::BooleanNode;
     true_node->value = true;
+    true_node->ctype.basetype = PType::boolean;
+    true_node->ctype.dtype = DType::Local;
     static_true = true_node;
 
     BooleanNode *false_node = new BooleanNode;
     false_node->type = AstNodeType::BooleanNode;
     false_node->value = false;
+    false_node->ctype.basetype = PType::boolean;
+    false_node->ctype.dtype = DType::Local;
     static_false = false_node;
   }
 
@@ -221,8 +318,22 @@ AstNode *make_actor(HylicModule* module, std::string s, std::map<std::string, Fu
   actor_def->name = s;
   actor_def->module = module;
   actor_def->functions = functions;
+  for (auto &[name, func] : functions) {
+    actor_def->methods[func->method_id] = func;
+    func->entity_def = actor_def;
+  }
   actor_def->data = data;
   actor_def->inocaps = inocaps;
+  for (auto &[name, _] : data) {
+    int slot = actor_def->field_slots.size();
+    actor_def->field_slots[name] = slot;
+  }
+  for (auto &k : inocaps) {
+    if (actor_def->field_slots.find(k.var_name) == actor_def->field_slots.end()) {
+      int slot = actor_def->field_slots.size();
+      actor_def->field_slots[k.var_name] = slot;
+    }
+  }
   actor_def->preamble = preamble;
   actor_def->postamble = postamble;
   return actor_def;
@@ -232,6 +343,7 @@ AstNode *make_function(std::string s, std::vector<std::string> args, std::vector
   FuncStmt *func_stmt = new FuncStmt;
   func_stmt->type = AstNodeType::FuncStmt;
   func_stmt->name = s;
+  func_stmt->method_id = intern_method(s);
   func_stmt->args = args;
   func_stmt->param_types = param_types;
   func_stmt->body = body;
@@ -259,6 +371,7 @@ AstNode *make_range(AstNode *range_start, AstNode *range_end) {
   range_node->range_start = range_start;
   range_node->range_end = range_end;
   range_node->ctype.basetype = PType::List;
+  range_node->ctype.dtype = DType::Local;
   range_node->ctype.subtype = lu8();
 
   return range_node;
@@ -269,6 +382,7 @@ AstNode *make_message_node(AstNode* entity_ref, std::string function_name, CommM
   func_call->type = AstNodeType::MessageNode;
   func_call->entity_ref = entity_ref;
   func_call->function_name = function_name;
+  func_call->method_id = intern_method(function_name);
   func_call->comm_mode = comm_mode;
   func_call->args = args;
 
@@ -310,15 +424,67 @@ AstNode *make_entity_ref(int node_id, int vat_id, int entity_id) {
 }
 
 AstNode *make_list(std::vector<AstNode *> list, CType *ctype) {
+  ValueTag elements = list.empty() ? ValueTag::Empty : make_value(list[0]).tag;
+  for (auto elem : list) {
+    if (elem->type == AstNodeType::NumberNode && elements == ValueTag::Number) continue;
+    if (elem->type == AstNodeType::BooleanNode && elements == ValueTag::Boolean) continue;
+    elements = ValueTag::Object;
+  }
+
+  if (elements == ValueTag::Number || elements == ValueTag::Boolean) {
+    std::vector<s64> numbers;
+    for (auto elem : list) {
+      auto value = make_value(elem);
+      numbers.push_back(elements == ValueTag::Number ? value.number : value.boolean);
+    }
+    return make_unboxed_list(numbers, elements, ctype);
+  }
+
   ListNode *list_node = new ListNode;
   list_node->type = AstNodeType::ListNode;
+  list_node->elements = elements;
   list_node->list = list;
   list_node->ctype.basetype = PType::List;
+  list_node->ctype.dtype = DType::Local;
   list_node->ctype.subtype = ctype;
 
   return list_node;
 }
 
+AstNode *make_unboxed_list(std::vector<s64> numbers, ValueTag elements, CType *ctype) {
+  ListNode *list_node = new ListNode;
+  list_node->type = AstNodeType::ListNode;
+  list_node->elements = numbers.empty() ? ValueTag::Empty : elements;
+  list_node->numbers = numbers;
+  list_node->ctype.basetype = PType::List;
+  list_node->ctype.dtype = DType::Local;
+  list_node->ctype.subtype = ctype;
+
+  return list_node;
+}
+
+size_t list_size(ListNode *list) {
+  return list->elements == ValueTag::Object ? list->list.size() : list->numbers.size();
+}
+
+Value list_get(ListNode *list, size_t index) {
+  switch (list->elements) {
+  case ValueTag::Number:
+    return make_number_value(list->numbers[index]);
+  case ValueTag::Boolean:
+    return make_boolean_value(list->numbers[index]);
+  default:
+    return make_value(list->list[index]);
+  }
+}
+
+bool list_fits(ListNode *list, const Value &value) {
+  if (value.tag != ValueTag::Number && value.tag != ValueTag::Boolean) {
+    return list->elements == ValueTag::Object;
+  }
+  return list->elements == value.tag || list->elements == ValueTag::Empty;
+}
+
 AstNode *make_promise_node(int promise_id) {
   PromiseNode *promise_node = new PromiseNode;
   promise_node->type = AstNodeType::PromiseNode;
@@ -333,11 +499,12 @@ AstNode *make_promise_resolution_node(std::string sym,
   promise_res_node->type = AstNodeType::PromiseResNode;
   promise_res_node->body = body;
   promise_res_node->sym = sym;
+  promise_res_node->promise = (SymbolNode *)make_symbol(sym);
 
   return promise_res_node;
 }
 
-AstNode *make_foreign_func_call(AstNode *(*foreign_func)(EvalContext* context, std::vector<AstNode *>), std::vector<AstNode*> args, CType ret_type) {
+AstNode *make_foreign_func_call(Value (*foreign_func)(EvalContext* context, std::vector<Value>), std::vector<AstNode*> args, CType ret_type) {
   ForeignFuncCall *ffc = new ForeignFuncCall;
   ffc->type = AstNodeType::ForeignFunc;
   ffc->foreign_func = foreign_func;
@@ -355,12 +522,15 @@ AstNode *make_index_node(AstNode *list, AstNode *accessor) {
 }
 
 void destroy_ast_obj(AstNode *node) {
-  printf("Destroying\n");
   switch(node->type) {
     case AstNodeType::StringNode:{
       auto str_nd = safe_ncast<StringNode*>(node, AstNodeType::StringNode);
       delete str_nd;
     } break;
+    case AstNodeType::RopeNode:{
+      // Its sides are collected separately
+      delete (RopeNode *)node;
+    } break;
   }
 }
 
@@ -452,14 +622,58 @@ void print_ctype(CType ctype) {
 }
 
 std::string extract_string(AstNode *node) {
-  assert(node->type == AstNodeType::StringNode);
+  if (node->type == AstNodeType::StringNode) {
+    return ((StringNode*) node)->value;
+  }
+
+  std::string out;
+  out.reserve(string_length(node));
+
+  // Ropes built in a loop are as deep as the loop is long, so no recursion
+  std::vector<AstNode *> pending = {node};
+  while (!pending.empty()) {
+    auto next = pending.back();
+    pending.pop_back();
+
+    if (next->type == AstNodeType::RopeNode) {
+      pending.push_back(((RopeNode *)next)->right);
+      pending.push_back(((RopeNode *)next)->left);
+    } else {
+      out += safe_ncast<StringNode *>(next, AstNodeType::StringNode)->value;
+    }
+  }
+
+  return out;
+}
+
+u64 string_length(AstNode *node) {
+  if (node->type == AstNodeType::RopeNode) {
+    return ((RopeNode *)node)->length;
+  }
 
-  return ((StringNode*) node)->value;
+  return safe_ncast<StringNode *>(node, AstNodeType::StringNode)->value.size();
 }
 
 std::string stringify_value_node(AstNode *node) {
   switch(node->type) {
   case AstNodeType::StringNode: return ((StringNode*)node)->value;
+  case AstNodeType::RopeNode: return extract_string(node);
+  case AstNodeType::NumberNode: return std::to_string(((NumberNode*)node)->value);
+  case AstNodeType::BooleanNode: return ((BooleanNode*)node)->value ? "#t" : "#f";
+  case AstNodeType::Nop: return "nop";
+  case AstNodeType::PromiseNode: return "promise " + std::to_string(((PromiseNode*)node)->promise_id);
+  case AstNodeType::EntityRefNode: {
+    auto ref = (EntityRefNode*)node;
+    return "entity " + std::to_string(ref->node_id) + ":" + std::to_string(ref->vat_id) + ":" + std::to_string(ref->entity_id);
+  }
+  case AstNodeType::ListNode: {
+    std::string out = "[";
+    auto list = (ListNode*)node;
+    for (size_t i = 0; i < list_size(list); ++i) {
+      out += (out.size() > 1 ? " " : "") + stringify_value(list_get(list, i));
+    }
+    return out + "]";
+  }
   }
 
   return "";
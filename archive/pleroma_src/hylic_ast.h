@@ -2,13 +2,18 @@
 
 #include "common.h"
 #include "hylic_tokenizer.h"
+#include "hylic_value.h"
+#include <atomic>
 #include <cassert>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include "general_util.h"
 #include "allocators.h"
+#include "cow_vector.h"
+#include "method_ids.h"
 
 enum class AstNodeType {
   Stmt,
@@ -37,6 +42,7 @@ enum class AstNodeType {
   NumberNode,
   ListNode,
   StringNode,
+  RopeNode,
   CharacterNode,
   PromiseNode,
   TupleNode,
@@ -97,17 +103,26 @@ enum class PType {
 };
 
 struct CType {
-  PType basetype;
+  PType basetype = PType::NotAssigned;
 
   DType dtype;
-  CType* subtype;
+  CType* subtype = nullptr;
   std::string entity_name;
 
   std::list<Token *>::iterator start;
   std::list<Token *>::iterator end;
 };
 
+// Bytecode for a body, see hylic_compiler.h
+struct Chunk;
+struct EntityDef;
+
+// Nodes made on this thread, see bench_engines()
+extern thread_local u64 ast_allocations;
+
 struct AstNode {
+  AstNode() { ast_allocations++; }
+
   AstNodeType type;
   AstNode *parent;
 
@@ -168,16 +183,30 @@ struct ModuleStmt : AstNode {
 
 struct FuncStmt : AstNode {
   std::string name;
+  MethodId method_id;
 
   std::vector<CType *> param_types;
   std::vector<std::string> args;
 
   std::vector<AstNode *> body;
   bool pure;
+
+  // Locals slots, arguments first.  -1 until resolved.
+  int frame_size = -1;
+  Chunk *chunk = nullptr;
+
+  // The entity that dispatches method_id to this function
+  EntityDef *entity_def = nullptr;
+
+  // Pure, and only calls builtins and functions that are too, so it has no
+  // side effects: it may run off the vat's burner and its results may be
+  // memoised.  Set by optimise().
+  bool parallel_safe = false;
 };
 
 struct ForStmt : AstNode {
   std::string sym;
+  int slot = -1;
   AstNode *generator;
   std::vector<AstNode *> body;
 };
@@ -208,22 +237,47 @@ struct ValueNode : AstNode {
   ValueType value_type;
 };
 
+// Where a symbol lives, filled in by resolve().  Anything the resolver
+// can't place (entity definitions, symbols built after loading) is looked up
+// by name at runtime.
+enum class SymbolScope { Dynamic, Local, Field };
+
 struct SymbolNode : AstNode {
   std::string sym;
+
+  SymbolScope scope = SymbolScope::Dynamic;
+  // Frame slot for locals, index into Entity::data for fields
+  int slot = -1;
 };
 
 struct NumberNode : ValueNode {
   int64_t value;
 };
 
+// Lists of numbers or of booleans keep them unboxed in `numbers`, anything
+// else is boxed in `list`.  A list is boxed for good the first time it's
+// given an element that doesn't fit.
 struct ListNode : ValueNode {
-  std::vector<AstNode *> list;
+  // Number or Boolean while unboxed, Object once boxed, Empty until the first element
+  ValueTag elements = ValueTag::Empty;
+
+  // Literals and the lists made from them share elements until one is written
+  CowVector<AstNode *> list;
+  CowVector<s64> numbers;
 };
 
 struct StringNode : ValueNode {
   std::string value;
 };
 
+// A string built by concatenation, left then right.  Each side is a
+// StringNode or another RopeNode; extract_string() flattens it.
+struct RopeNode : ValueNode {
+  AstNode *left;
+  AstNode *right;
+  u64 length;
+};
+
 struct BooleanNode : ValueNode {
   bool value;
 };
@@ -250,35 +304,71 @@ struct UsertypeValueNode : ValueNode {
 struct PromiseResNode : AstNode {
   std::string sym;
   std::vector<AstNode *> body;
+
+  // The promise, read from the enclosing frame.  The body runs later in a
+  // frame of its own with the result in slot 0.
+  SymbolNode *promise;
+  int frame_size = 1;
+  Chunk *chunk = nullptr;
 };
 
 struct MessageNode : AstNode {
   AstNode* entity_ref;
   std::string function_name;
+  MethodId method_id;
 
   MessageDistance message_distance;
   CommMode comm_mode;
 
   std::vector<AstNode *> args;
+
+  // Monomorphic inline cache, the function this site last called.  Only valid
+  // while the callee's entity_def matches the receiver's.
+  std::atomic<FuncStmt *> cached_func{nullptr};
 };
 
+// The fallthrough arm runs only when no other arm matches, wherever it is.
+// Matches whose arms are all literals of one kind dispatch through a table
+// instead of trying the arms in turn, see build_match_table().
 struct MatchNode : AstNode {
   AstNode *match_expr;
   std::vector<std::tuple<AstNode *, std::vector<AstNode *>>> cases;
+
+  // Index into cases of the fallthrough arm, -1 if there's none
+  int default_case = -1;
+
+  // Number, Boolean or Object (strings) if the table is used, else Empty.
+  // Both map a literal to the first arm that has it.
+  ValueTag table_tag = ValueTag::Empty;
+  std::unordered_map<s64, int> number_table;
+  std::unordered_map<std::string, int> string_table;
 };
 
+// What typesolve() found both operands of an OperatorExpr or BooleanExpr to
+// be.  Both engines skip the runtime checks for Number and String, Dynamic
+// operands are checked as they come.
+enum class OperandKind { Dynamic, Number, String };
+
+// term1 is the right operand, term2 the left
 struct OperatorExpr : AstNode {
   enum Op { Plus, Minus, Times, Divide } op;
   AstNode *term1;
   AstNode *term2;
+  OperandKind operands = OperandKind::Dynamic;
+
+  // A string this makes never outlives the function it's in, so it's kept
+  // by the frame rather than the GC.  Set by optimise().
+  bool frame_local = false;
 };
 
 struct FallthroughExpr : AstNode {};
 
+// term1 is the left operand, term2 the right
 struct BooleanExpr : AstNode {
   enum Op { GreaterThan, LessThan, Equals, GreaterThanEqual, LessThanEqual } op;
   AstNode *term1;
   AstNode *term2;
+  OperandKind operands = OperandKind::Dynamic;
 };
 
 struct EntityDef : AstNode {
@@ -286,7 +376,11 @@ struct EntityDef : AstNode {
   std::string name;
   HylicModule* module;
   std::map<std::string, FuncStmt *> functions;
+  // Dispatch table, same functions keyed by method id
+  std::map<MethodId, FuncStmt *> methods;
   std::map<std::string, AstNode *> data;
+  // Index of each data field and inocap in Entity::data
+  std::map<std::string, int> field_slots;
 
   std::vector<std::string> preamble;
   std::vector<std::string> postamble;
@@ -312,7 +406,7 @@ struct IndexNode : AstNode {
 struct EvalContext;
 
 struct ForeignFuncCall : AstNode {
-  AstNode *(*foreign_func)(EvalContext*, std::vector<AstNode *>);
+  Value (*foreign_func)(EvalContext*, std::vector<Value>);
   std::vector<AstNode *> args;
 };
 
@@ -324,6 +418,8 @@ AstNode *make_fallthrough();
 AstNode *make_boolean_expr(BooleanExpr::Op op, AstNode *expr1, AstNode *expr2);
 AstNode *make_assignment(AstNode *sym, AstNode *expr);
 AstNode *make_match(AstNode *match_expr, std::vector<std::tuple<AstNode *, std::vector<AstNode *>>> cases);
+// Redone whenever the arms change
+void build_match_table(MatchNode *node);
 AstNode *make_namespace_access(AstNode* ref, AstNode* field);
 AstNode *make_while(AstNode *generator, std::vector<AstNode *> body);
 AstNode *make_module_stmt(std::string s, bool namespaced, std::map<std::string, AstNode*> symbol_table);
@@ -331,6 +427,11 @@ AstNode *make_table(std::map<std::string, AstNode *> vals);
 
 AstNode *make_number(int64_t v);
 AstNode *make_string(std::string s);
+AstNode *make_rope(AstNode *left, AstNode *right);
+// A new list sharing the elements of list, copied on the first write
+AstNode *share_list(ListNode *list);
+// Nodes that evaluate to themselves
+bool is_literal(AstNode *obj);
 AstNode *make_boolean(bool b);
 
 AstNode *make_symbol(std::string s);
@@ -344,13 +445,19 @@ AstNode *make_comment(std::string comment);
 AstNode *make_message_node(AstNode* entity_ref, std::string function_name, CommMode comm_mode, std::vector<AstNode *> args);
 AstNode *make_create_entity(std::string entity_name, bool new_vat);
 AstNode *make_entity_ref(int node_id, int vat_id, int entity_id);
+// Numbers and booleans are unboxed if every element is one of them
 AstNode *make_list(std::vector<AstNode *> list, CType * ctype);
+AstNode *make_unboxed_list(std::vector<s64> numbers, ValueTag elements, CType *ctype);
+size_t list_size(ListNode *list);
+Value list_get(ListNode *list, size_t index);
+// Whether value can be stored in list without boxing it
+bool list_fits(ListNode *list, const Value &value);
 AstNode *make_promise_node(int promise_id);
 AstNode *make_mod_use(std::string mod_name, AstNode * accessor);
 AstNode *make_index_node(AstNode * list, AstNode * accessor);
 // HACK Make this an AstNode and then eval + check in symbol table
 AstNode *make_promise_resolution_node(std::string sym, std::vector<AstNode *> body);
-AstNode *make_foreign_func_call(AstNode * (*foreign_func)(EvalContext *, std::vector<AstNode *>), std::vector<AstNode *> args, CType ret_type);
+AstNode *make_foreign_func_call(Value (*foreign_func)(EvalContext *, std::vector<Value>), std::vector<AstNode *> args, CType ret_type);
 
 // Destroy
 void destroy_ast_obj(AstNode* node);
@@ -368,7 +475,9 @@ void print_ctype(CType ctype);
 
 std::string entity_ref_str(EntityRefNode *ref);
 
+// Contents of a StringNode or RopeNode
 std::string extract_string(AstNode* node);
+u64 string_length(AstNode *node);
 
 std::string stringify_value_node(AstNode* node);
 
@@ -379,3 +488,12 @@ T safe_ncast(AstNode* node, AstNodeType node_type) {
   }
   return static_cast<T>(node);
 }
+
+// Objects only, see safe_ncast()
+template <class T>
+T value_ncast(const Value &value, AstNodeType node_type) {
+  if (value.tag != ValueTag::Object) {
+    panic("Expected type " + ast_type_to_string(node_type) + ", but got " + value_tag_to_string(value.tag));
+  }
+  return safe_ncast<T>(value.object, node_type);
+}
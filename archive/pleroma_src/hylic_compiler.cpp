@@ -1,147 +1,428 @@
 #include "hylic_compiler.h"
 #include "hylic_ast.h"
+#include "general_util.h"
 #include <tuple>
 
-// Instructions
-namespace Hlcn {
-const u32 Exit = 0x00;
-const u32 Call = 0x06;
-};
+int emit(CompileContext *cc, Hlcn::Op op, int a = 0, int b = 0) {
+  cc->chunk->code.push_back({op, a, b});
+  return cc->chunk->code.size() - 1;
+}
 
-void cc_u64(CompileContext *cc, u64 value) {
-  cc->comp_out.put(value << 56);
-  cc->comp_out.put(value << 48);
-  cc->comp_out.put(value << 40);
-  cc->comp_out.put(value << 32);
-  cc->comp_out.put(value << 24);
-  cc->comp_out.put(value << 16);
-  cc->comp_out.put(value << 8);
-  cc->comp_out.put(value);
+int cc_constant(CompileContext *cc, AstNode *node) {
+  cc->chunk->constants.push_back(node);
+  cc->chunk->values.push_back(make_value(node));
+  return cc->chunk->constants.size() - 1;
 }
 
-void cc_u32(CompileContext *cc, u32 value) {
-  cc->comp_out.put(value << 24);
-  cc->comp_out.put(value << 16);
-  cc->comp_out.put(value << 8);
-  cc->comp_out.put(value);
+int cc_here(CompileContext *cc) {
+  return cc->chunk->code.size();
 }
 
-void cc_constant(CompileContext *cc, NumberNode* node) {
-  cc->comp_out.put(0x08);
-  cc->comp_out.put(node->value);
+void cc_fail(CompileContext *cc, std::string msg) {
+  emit(cc, Hlcn::Fail, cc_constant(cc, make_string(msg)));
 }
 
-void cc_operator(CompileContext *cc, OperatorExpr* node) {
-  compile_node(cc, node->term1);
-  compile_node(cc, node->term2);
+enum class BlockMode {
+  Body,  // returns its value
+  Value, // leaves its value on the stack
+  Loop   // leaves nothing
+};
 
-  switch(node->op) {
-  case OperatorExpr::Op::Plus:
-    cc->comp_out.put(0x02);
-    break;
-  case OperatorExpr::Op::Minus:
-    cc->comp_out.put(0x03);
+// A block evaluates to the value of its first return, or nop.  Only the
+// outermost block of a body actually returns: eval_block() hands a nested
+// return's value to the statement holding the block, which carries on.
+void cc_block(CompileContext *cc, std::vector<AstNode *> &block, BlockMode mode) {
+  bool returned = false;
+  for (auto node : block) {
+    if (node->type == AstNodeType::ReturnNode) {
+      compile_node(cc, ((ReturnNode *)node)->expr);
+      returned = true;
+      break;
+    }
+
+    compile_node(cc, node);
+    emit(cc, Hlcn::Pop);
+  }
+
+  if (mode == BlockMode::Loop) {
+    if (returned) {
+      emit(cc, Hlcn::Pop);
+    }
+    return;
+  }
+
+  if (!returned) {
+    emit(cc, Hlcn::Const, cc_constant(cc, make_nop()));
+  }
+
+  if (mode == BlockMode::Body) {
+    emit(cc, Hlcn::Return);
+  }
+}
+
+void cc_symbol(CompileContext *cc, SymbolNode *node) {
+  switch (node->scope) {
+  case SymbolScope::Local:
+    emit(cc, Hlcn::LoadLocal, node->slot, cc_constant(cc, node));
     break;
-  case OperatorExpr::Op::Times:
-    cc->comp_out.put(0x04);
+  case SymbolScope::Field:
+    emit(cc, Hlcn::LoadField, node->slot, cc_constant(cc, node));
     break;
-  case OperatorExpr::Op::Divide:
-    cc->comp_out.put(0x05);
+  case SymbolScope::Dynamic:
+    emit(cc, Hlcn::LoadDynamic, 0, cc_constant(cc, node));
     break;
   }
 }
 
-void cc_message(CompileContext *cc, MessageNode* node) {
-  if (node->function_name == "Exit") {
-    cc->comp_out.put(Hlcn::Exit);
-    cc->comp_out.put(0x0);
+void cc_assignment(CompileContext *cc, AssignmentStmt *node) {
+  if (node->sym->type == AstNodeType::SymbolNode) {
+    auto sym = (SymbolNode *)node->sym;
+    compile_node(cc, node->value);
+
+    switch (sym->scope) {
+    case SymbolScope::Local:
+      emit(cc, Hlcn::StoreLocal, sym->slot);
+      break;
+    case SymbolScope::Field:
+      emit(cc, Hlcn::StoreField, sym->slot);
+      break;
+    case SymbolScope::Dynamic:
+      emit(cc, Hlcn::StoreDynamic, 0, cc_constant(cc, sym));
+      break;
+    }
+  } else if (node->sym->type == AstNodeType::IndexNode && ((IndexNode *)node->sym)->list->type == AstNodeType::SymbolNode) {
+    auto ind_node = (IndexNode *)node->sym;
+    compile_node(cc, node->value);
+    compile_node(cc, ind_node->list);
+    compile_node(cc, ind_node->accessor);
+    emit(cc, Hlcn::StoreIndex);
+  } else {
+    cc_fail(cc, "Invalid assignment.");
+  }
+}
+
+void cc_operator(CompileContext *cc, OperatorExpr *node) {
+  compile_node(cc, node->term1);
+  compile_node(cc, node->term2);
+
+  if (node->operands == OperandKind::Number) {
+    emit(cc, Hlcn::NumberOp, node->op);
+  } else if (node->operands == OperandKind::String) {
+    emit(cc, Hlcn::Concat, node->frame_local);
+  } else {
+    emit(cc, Hlcn::Operator, node->op);
+  }
+}
+
+void cc_comparison(CompileContext *cc, BooleanExpr *node) {
+  compile_node(cc, node->term1);
+  compile_node(cc, node->term2);
+
+  if (node->operands == OperandKind::Number) {
+    emit(cc, Hlcn::NumberCompare, node->op);
+  } else if (node->operands == OperandKind::String) {
+    emit(cc, Hlcn::StringEquals);
+  } else {
+    emit(cc, Hlcn::Compare, node->op);
+  }
+}
+
+void cc_while(CompileContext *cc, WhileStmt *node) {
+  int top = cc_here(cc);
+  compile_node(cc, node->generator);
+  int exit_jump = emit(cc, Hlcn::JumpIfFalse);
+
+  cc_block(cc, node->body, BlockMode::Loop);
+  emit(cc, Hlcn::Jump, top);
+
+  cc->chunk->code[exit_jump].a = cc_here(cc);
+  emit(cc, Hlcn::Const, cc_constant(cc, make_nop()));
+}
+
+void cc_for(CompileContext *cc, ForStmt *node) {
+  // Ranges are counted through rather than built
+  if (node->generator->type == AstNodeType::RangeNode) {
+    auto range_node = (RangeNode *)node->generator;
+    compile_node(cc, range_node->range_start);
+    compile_node(cc, range_node->range_end);
+    emit(cc, Hlcn::ForRange);
+  } else {
+    compile_node(cc, node->generator);
+    emit(cc, Hlcn::ForPrep);
+  }
+
+  int top = emit(cc, Hlcn::ForNext, node->slot);
+  cc_block(cc, node->body, BlockMode::Loop);
+  emit(cc, Hlcn::Jump, top);
+
+  cc->chunk->code[top].b = cc_here(cc);
+  emit(cc, Hlcn::Const, cc_constant(cc, make_nop()));
+}
+
+// Arms follow the dispatch, each jumping past the rest when it's done
+void cc_match_table(CompileContext *cc, MatchNode *node) {
+  compile_node(cc, node->match_expr);
+
+  int table = cc->chunk->jump_tables.size();
+  cc->chunk->jump_tables.emplace_back();
+  emit(cc, Hlcn::MatchTable, cc_constant(cc, node), table);
+
+  std::vector<int> targets;
+  std::vector<int> exit_jumps;
+  for (auto &match_case : node->cases) {
+    targets.push_back(cc_here(cc));
+    cc_block(cc, std::get<1>(match_case), BlockMode::Value);
+    exit_jumps.push_back(emit(cc, Hlcn::Jump));
+  }
+
+  targets.push_back(cc_here(cc));
+  emit(cc, Hlcn::Const, cc_constant(cc, make_nop()));
+
+  for (auto k : exit_jumps) {
+    cc->chunk->code[k].a = cc_here(cc);
+  }
+  cc->chunk->jump_tables[table] = targets;
+}
+
+// The matched value stays on the stack until a case is taken, the
+// fallthrough arm goes last
+void cc_match(CompileContext *cc, MatchNode *node) {
+  if (node->table_tag != ValueTag::Empty) {
+    cc_match_table(cc, node);
     return;
   }
 
-  if (node->comm_mode == CommMode::Sync) {
-    cc->comp_out.put(Hlcn::Call);
-
-    // thunk
-    cc->function_thunks.push_back(std::make_tuple(node->function_name, cc->comp_out.tellp()));
-    cc_u64(cc, 0x0);
-    //cc->comp_out.put(cc->functions[node->function_name]);
-    //printf("Calling %d\n", cc->functions[node->function_name]);
-  } else if (node->comm_mode == CommMode::Async) {
+  compile_node(cc, node->match_expr);
+
+  std::vector<int> exit_jumps;
+  for (auto &match_case : node->cases) {
+    if (std::get<0>(match_case)->type == AstNodeType::FallthroughExpr) {
+      continue;
+    }
+
+    compile_node(cc, std::get<0>(match_case));
+    int next_case = emit(cc, Hlcn::MatchJump);
+
+    emit(cc, Hlcn::Pop);
+    cc_block(cc, std::get<1>(match_case), BlockMode::Value);
+    exit_jumps.push_back(emit(cc, Hlcn::Jump));
+
+    cc->chunk->code[next_case].a = cc_here(cc);
+  }
+
+  emit(cc, Hlcn::Pop);
+  if (node->default_case != -1) {
+    cc_block(cc, std::get<1>(node->cases[node->default_case]), BlockMode::Value);
   } else {
-    panic("NYI");
+    emit(cc, Hlcn::Const, cc_constant(cc, make_nop()));
+  }
+
+  for (auto k : exit_jumps) {
+    cc->chunk->code[k].a = cc_here(cc);
   }
 }
 
-void cc_function(CompileContext *cc, FuncStmt* stmt) {
-  for (auto &k: stmt->body) {
-    compile_node(cc, k);
+void cc_message(CompileContext *cc, MessageNode *node) {
+  for (auto arg : node->args) {
+    compile_node(cc, arg);
   }
 
-  cc->comp_out.put(0x07);
+  if (node->entity_ref) {
+    compile_node(cc, node->entity_ref);
+  } else {
+    emit(cc, Hlcn::Self);
+  }
+
+  if (node->comm_mode == CommMode::Sync) {
+    emit(cc, Hlcn::Call, cc_constant(cc, node), node->args.size());
+  } else {
+    emit(cc, Hlcn::Send, cc_constant(cc, node), node->args.size());
+  }
 }
 
-void compile_node(CompileContext *cc, AstNode* in_node) {
+void cc_promise_resolution(CompileContext *cc, PromiseResNode *node) {
+  node->chunk = compile_body("@" + node->sym, node->body);
+
+  cc_symbol(cc, node->promise);
+  emit(cc, Hlcn::OnResolve, cc_constant(cc, node));
+}
+
+void compile_node(CompileContext *cc, AstNode *in_node) {
   switch (in_node->type) {
-  case AstNodeType::NumberNode: {
-    auto node = safe_ncast<NumberNode *>(in_node, AstNodeType::NumberNode);
-    cc_constant(cc, node);
+  case AstNodeType::SymbolNode: {
+    cc_symbol(cc, (SymbolNode *)in_node);
+  } break;
+  case AstNodeType::AssignmentStmt: {
+    cc_assignment(cc, (AssignmentStmt *)in_node);
   } break;
   case AstNodeType::OperatorExpr: {
-    auto node = safe_ncast<OperatorExpr *>(in_node, AstNodeType::OperatorExpr);
-    cc_operator(cc, node);
-  } break;
-  case AstNodeType::EntityDef: {
-    printf("ENT!\n");
-    auto ent_def_node = safe_ncast<EntityDef*>(in_node, AstNodeType::EntityDef);
-    for (auto &[func_name, func_def] : ent_def_node->functions) {
-      auto func_node = safe_ncast<FuncStmt *>(func_def, AstNodeType::FuncStmt);
-      cc->functions[ent_def_node->name + "::" + func_node->name] = cc->comp_out.tellp();
-      printf("%s\n", func_name.c_str());
-      cc_function(cc, func_node);
-    }
+    cc_operator(cc, (OperatorExpr *)in_node);
+  } break;
+  case AstNodeType::BooleanExpr: {
+    cc_comparison(cc, (BooleanExpr *)in_node);
+  } break;
+  case AstNodeType::WhileStmt: {
+    cc_while(cc, (WhileStmt *)in_node);
+  } break;
+  case AstNodeType::ForStmt: {
+    cc_for(cc, (ForStmt *)in_node);
+  } break;
+  case AstNodeType::MatchNode: {
+    cc_match(cc, (MatchNode *)in_node);
   } break;
   case AstNodeType::MessageNode: {
-    auto node = safe_ncast<MessageNode *>(in_node, AstNodeType::MessageNode);
-    cc_message(cc, node);
+    cc_message(cc, (MessageNode *)in_node);
+  } break;
+  case AstNodeType::IndexNode: {
+    auto node = (IndexNode *)in_node;
+    compile_node(cc, node->list);
+    compile_node(cc, node->accessor);
+    emit(cc, Hlcn::Index);
+  } break;
+  case AstNodeType::RangeNode: {
+    auto node = (RangeNode *)in_node;
+    compile_node(cc, node->range_start);
+    compile_node(cc, node->range_end);
+    emit(cc, Hlcn::Range);
+  } break;
+  case AstNodeType::ListNode: {
+    // A fresh list each time, sharing the literal's elements if it can
+    auto node = (ListNode *)in_node;
+    bool all_literal = true;
+    for (auto k : node->list) {
+      all_literal = all_literal && is_literal(k);
+    }
+    if (all_literal) {
+      emit(cc, Hlcn::ShareList, cc_constant(cc, node));
+      break;
+    }
+
+    for (auto k : node->list) {
+      compile_node(cc, k);
+    }
+    emit(cc, Hlcn::MakeList, node->list.size(), cc_constant(cc, node));
+  } break;
+  case AstNodeType::SelfNode: {
+    emit(cc, Hlcn::Self);
+  } break;
+  case AstNodeType::CreateEntity: {
+    emit(cc, Hlcn::CreateEntity, cc_constant(cc, in_node));
+  } break;
+  case AstNodeType::ForeignFunc: {
+    auto node = (ForeignFuncCall *)in_node;
+    for (auto k : node->args) {
+      compile_node(cc, k);
+    }
+    emit(cc, Hlcn::Foreign, cc_constant(cc, node), node->args.size());
+  } break;
+  case AstNodeType::ModUseNode: {
+    auto node = (ModUseNode *)in_node;
+    emit(cc, Hlcn::EnterModule, cc_constant(cc, node));
+    compile_node(cc, node->accessor);
+    emit(cc, Hlcn::LeaveModule);
+  } break;
+  case AstNodeType::PromiseResNode: {
+    cc_promise_resolution(cc, (PromiseResNode *)in_node);
+  } break;
+  case AstNodeType::ModuleStmt:
+  case AstNodeType::FuncStmt: {
+    emit(cc, Hlcn::Const, cc_constant(cc, make_nop()));
+  } break;
+  // Evaluate to themselves
+  case AstNodeType::NumberNode:
+  case AstNodeType::StringNode:
+  case AstNodeType::BooleanNode:
+  case AstNodeType::EntityRefNode:
+  case AstNodeType::PromiseNode:
+  case AstNodeType::ReturnNode:
+  case AstNodeType::CommentNode:
+  case AstNodeType::TableNode:
+  case AstNodeType::EntityDef:
+  case AstNodeType::Nop: {
+    emit(cc, Hlcn::Const, cc_constant(cc, in_node));
+  } break;
+  default: {
+    cc_fail(cc, "Failing to evaluate node type " + ast_type_to_string(in_node->type));
   } break;
   }
 }
 
-void _compile(std::vector<AstNode*> test_body) {
+Chunk *compile_body(std::string name, std::vector<AstNode *> &body) {
   CompileContext cc;
-  cc.comp_out.open("../halcyonist/out.plmb", std::ios::binary | std::ios::out);
+  cc.chunk = new Chunk;
+  cc.chunk->name = name;
 
-  for (auto &k: test_body) {
-    compile_node(&cc, k);
-  }
+  cc_block(&cc, body, BlockMode::Body);
 
-  for (auto &z : cc.function_thunks) {
-    std::string func_name = std::get<0>(z);
-    u64 thunk_pos = std::get<1>(z);
+  return cc.chunk;
+}
 
-    cc.comp_out.seekp(thunk_pos);
-    cc_u64(&cc, cc.functions[func_name]);
-    printf("Fixed it with func pos %d\n", thunk_pos);
-  }
+void compile(HylicModule *module) {
+  for (auto &[_, v] : module->entity_defs) {
+    auto entity_def = (EntityDef *)v;
 
-  cc.comp_out.close();
-}
+    for (auto &[func_name, func] : entity_def->functions) {
+      // System modules share their builtins, which are compiled once
+      if (func->chunk) {
+        continue;
+      }
 
-void compile(std::map<std::string, AstNode *> program) {
+      func->chunk = compile_body(entity_def->name + "::" + func_name, func->body);
+    }
+  }
+}
 
-  auto func1 = (FuncStmt*) make_function("tester", {}, {make_operator_expr(OperatorExpr::Op::Plus, make_message_node(nullptr, "blah", CommMode::Sync, {}), make_operator_expr(OperatorExpr::Op::Plus, make_number(4), make_number(6))),}, {}, false);
+std::string op_name(Hlcn::Op op) {
+  switch (op) {
+  case Hlcn::Const: return "Const";
+  case Hlcn::Pop: return "Pop";
+  case Hlcn::Dup: return "Dup";
+  case Hlcn::LoadLocal: return "LoadLocal";
+  case Hlcn::StoreLocal: return "StoreLocal";
+  case Hlcn::LoadField: return "LoadField";
+  case Hlcn::StoreField: return "StoreField";
+  case Hlcn::LoadDynamic: return "LoadDynamic";
+  case Hlcn::StoreDynamic: return "StoreDynamic";
+  case Hlcn::Self: return "Self";
+  case Hlcn::Operator: return "Operator";
+  case Hlcn::Compare: return "Compare";
+  case Hlcn::NumberOp: return "NumberOp";
+  case Hlcn::Concat: return "Concat";
+  case Hlcn::NumberCompare: return "NumberCompare";
+  case Hlcn::StringEquals: return "StringEquals";
+  case Hlcn::MatchJump: return "MatchJump";
+  case Hlcn::MatchTable: return "MatchTable";
+  case Hlcn::Jump: return "Jump";
+  case Hlcn::JumpIfFalse: return "JumpIfFalse";
+  case Hlcn::MakeList: return "MakeList";
+  case Hlcn::ShareList: return "ShareList";
+  case Hlcn::Range: return "Range";
+  case Hlcn::Index: return "Index";
+  case Hlcn::StoreIndex: return "StoreIndex";
+  case Hlcn::ForPrep: return "ForPrep";
+  case Hlcn::ForRange: return "ForRange";
+  case Hlcn::ForNext: return "ForNext";
+  case Hlcn::Call: return "Call";
+  case Hlcn::Send: return "Send";
+  case Hlcn::CreateEntity: return "CreateEntity";
+  case Hlcn::Foreign: return "Foreign";
+  case Hlcn::EnterModule: return "EnterModule";
+  case Hlcn::LeaveModule: return "LeaveModule";
+  case Hlcn::OnResolve: return "OnResolve";
+  case Hlcn::Return: return "Return";
+  case Hlcn::Fail: return "Fail";
+  }
 
-  auto func2 = (FuncStmt*) make_function("blah", {}, {make_operator_expr(OperatorExpr::Op::Plus, make_number(9), make_operator_expr(OperatorExpr::Op::Plus, make_number(4), make_number(6))),}, {}, false);
+  return "?";
+}
 
-  std::map<std::string, FuncStmt *> funcs = {
-      {"blah", func2},
-      {"tester", func1},
-  };
+std::string disassemble(Chunk *chunk) {
+  std::string out = chunk->name + ":\n";
 
-  auto ex_act = make_actor(nullptr, "TestEnt", funcs, {}, {}, {}, {});
+  for (int k = 0; k < chunk->code.size(); ++k) {
+    auto &instr = chunk->code[k];
+    out += "\t" + std::to_string(k) + "\t" + op_name(instr.op) + " " + std::to_string(instr.a) + " " + std::to_string(instr.b) + "\n";
+  }
 
-  _compile({
-      make_message_node(nullptr, "TestEnt::blah", CommMode::Sync, {}),
-      ex_act,
-  });
+  return out;
 }
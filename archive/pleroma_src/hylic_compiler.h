@@ -1,16 +1,77 @@
 #pragma once
 
 #include "hylic_ast.h"
-#include <fstream>
-#include <map>
 #include <string>
+#include <vector>
 
-struct CompileContext {
-  std::ofstream comp_out;
+// Instructions.  Every expression leaves exactly one value on the stack.
+namespace Hlcn {
+enum Op : u8 {
+  Const,        // constants[a]
+  Pop,
+  Dup,
+  LoadLocal,    // locals[a], b is the SymbolNode constant for errors
+  StoreLocal,   // locals[a] = top, which stays on the stack
+  LoadField,    // entity field a, b as above
+  StoreField,
+  LoadDynamic,  // find_symbol() on the SymbolNode constant b
+  StoreDynamic,
+  Self,
+  Operator,     // a is an OperatorExpr::Op
+  Compare,      // a is a BooleanExpr::Op
+  NumberOp,     // as Operator, for operands typesolve() found to be numbers
+  Concat,       // Operator on strings, a is OperatorExpr::frame_local
+  NumberCompare,
+  StringEquals,
+  MatchJump,    // pops a case value, jumps to a unless it matches the value below
+  MatchTable,   // pops the value of the MatchNode constants[a], jumps to its arm in jump_tables[b]
+  Jump,         // to a
+  JumpIfFalse,  // pops a BooleanNode
+  MakeList,     // pops a values
+  ShareList,    // constants[a] is a ListNode of literals, pushes a list sharing them
+  Range,
+  Index,
+  StoreIndex,   // value, list, index -> value
+  ForPrep,      // pops the list to iterate
+  ForRange,     // pops the end and start of a range to count through
+  ForNext,      // locals[a] = next item, or jumps to b when done
+  Call,         // sync message, constants[a] is the MessageNode, b = argc: args..., target
+  Send,         // async message, same operands
+  CreateEntity, // constants[a] is the CreateEntityNode
+  Foreign,      // constants[a] is the ForeignFuncCall, b = argc
+  EnterModule,  // constants[a] is the ModUseNode
+  LeaveModule,
+  OnResolve,    // constants[a] is the PromiseResNode, pops the promise
+  Return,
+  Fail,         // throws constants[a], a StringNode
+};
+};
+
+struct Instr {
+  Hlcn::Op op;
+  int a;
+  int b;
+};
 
-  std::map<std::string, u64> functions;
-  std::vector<std::tuple<std::string, u64>> function_thunks;
+struct Chunk {
+  std::string name;
+  std::vector<Instr> code;
+  std::vector<AstNode *> constants;
+  // constants as values, so Const doesn't have to convert them
+  std::vector<Value> values;
+  // Code offsets of a tabled match's arms by case index, the last one is
+  // taken when nothing matches
+  std::vector<std::vector<int>> jump_tables;
 };
 
-void compile(std::map<std::string, AstNode*> program);
+struct CompileContext {
+  Chunk *chunk;
+};
+
+// Compiles every function of a resolved module, along with the promise
+// callbacks inside them
+void compile(HylicModule *module);
+Chunk *compile_body(std::string name, std::vector<AstNode *> &body);
 void compile_node(CompileContext *cc, AstNode *in_node);
+
+std::string disassemble(Chunk *chunk);
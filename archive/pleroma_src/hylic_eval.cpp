@@ -1,9 +1,9 @@
 #include "hylic_eval.h"
-#include "../other_src/blockingconcurrentqueue.h"
 #include "hylic.h"
 #include "hylic_ast.h"
 #include "other.h"
 #include "pleroma.h"
+#include <algorithm>
 #include <cassert>
 #include <string>
 #include <tuple>
@@ -12,14 +12,39 @@
 #include "system.h"
 #include "general_util.h"
 #include "type_util.h"
-
-extern moodycamel::BlockingConcurrentQueue<Vat *> queue;
-
-void set_msg_src(Msg *m, const EntityRefNode &ref) {
-  m->src_node_id = ref.node_id;
-  m->src_vat_id = ref.vat_id;
-  m->src_entity_id = ref.entity_id;
-}
+#include "scheduler.h"
+#include "timer_wheel.h"
+#include "hylic_vm.h"
+#include "worker_pool.h"
+
+// Builtins are recognised by their method ids
+const MethodId APPEND_METHOD = method_hash("append");
+const MethodId LEN_METHOD = method_hash("len");
+const MethodId AFTER_METHOD = method_hash("after");
+const MethodId EVERY_METHOD = method_hash("every");
+const MethodId CANCEL_TIMER_METHOD = method_hash("cancel-timer");
+const MethodId PROMISE_TIMEOUT_METHOD = method_hash("promise-timeout");
+const MethodId CANCEL_PROMISE_METHOD = method_hash("cancel-promise");
+const MethodId LIST_SUM_METHOD = method_hash("list-sum");
+const MethodId LIST_MIN_METHOD = method_hash("list-min");
+const MethodId LIST_MAX_METHOD = method_hash("list-max");
+const MethodId LIST_FIND_METHOD = method_hash("list-find");
+const MethodId LIST_MAP_METHOD = method_hash("list-map");
+const MethodId LIST_FILTER_METHOD = method_hash("list-filter");
+const MethodId LIST_PMAP_METHOD = method_hash("list-pmap");
+
+// Requests the runtime sends to the Monad
+const MethodId NEW_VAT_METHOD = method_hash("new-vat");
+const MethodId REQUEST_FAR_ENTITY_METHOD = method_hash("request-far-entity");
+
+// Elements a worker maps at a time, shorter lists aren't worth spreading
+const int PMAP_CHUNK = 256;
+
+// Concatenations up to this long make a plain StringNode
+const int MIN_ROPE_LENGTH = 64;
+
+Engine engine = Engine::Tree;
+int memo_size = 0;
 
 void set_msg_src(Msg *m, const EntityAddress &addr) {
   m->src_node_id = addr.node_id;
@@ -27,10 +52,10 @@ void set_msg_src(Msg *m, const EntityAddress &addr) {
   m->src_entity_id = addr.entity_id;
 }
 
-void set_msg_target(Msg *m, const EntityRefNode &ref) {
+void set_msg_target(Msg *m, const Value &ref) {
   m->node_id = ref.node_id;
-  m->vat_id = ref.vat_id;
-  m->entity_id = ref.entity_id;
+  m->vat_id = ref.ref.vat_id;
+  m->entity_id = ref.ref.entity_id;
 }
 
 void set_msg_target(Msg *m, const EntityAddress &addr) {
@@ -40,65 +65,137 @@ void set_msg_target(Msg *m, const EntityAddress &addr) {
 }
 
 int new_promise(EvalContext* context) {
-  int pid = context->vat->promise_id_base;
-  context->vat->promises[pid] = PromiseResult();
-  context->vat->promise_id_base++;
-  return pid;
+  return context->vat->promises.insert(PromiseResult());
 }
 
-AstNode *eval_block(EvalContext *context, std::vector<AstNode *> block,
-                    std::vector<std::tuple<std::string, AstNode *>> sub_syms) {
+// Bindings live in the frame's slots, so a block needs no scope of its own
+Value eval_block(EvalContext *context, const std::vector<AstNode *> &block) {
+  for (auto node : block) {
+    if (node->type == AstNodeType::ReturnNode) {
+      return eval(context, ((ReturnNode *)node)->expr);
+    }
+    eval(context, node);
+  }
+
+  return make_nop_value();
+}
 
-  push_scope(context);
+void on_promise_do(EvalContext* context, int promise_id, std::vector<AstNode*> body) {
+  PromiseResult *promise = context->vat->promises.find(promise_id);
+  assert(promise);
+  promise->callbacks.push_back((PromiseResNode *)make_promise_resolution_node("anon", body));
+}
 
-  // load symbols into scope
-  for (auto &[sym, node] : sub_syms) {
-    css(context).table[sym] = node;
+// Unhooks a dependent from every promise it is still waiting on
+void unlink_dependent(Vat *vat, DependPromFunc *dpf) {
+  std::vector<int> waiting_on;
+  if (dpf->target_depends_on != -1) {
+    waiting_on.push_back(dpf->target_depends_on);
+  }
+  for (auto &[pid, _] : dpf->depends_on) {
+    waiting_on.push_back(pid);
   }
 
-  AstNode *last_val;
-  for (auto node : block) {
-    last_val = eval(context, node);
-    if (last_val->type == AstNodeType::ReturnNode) {
-      auto v = (ReturnNode *)last_val;
-      return eval(context, v->expr);
+  for (auto pid : waiting_on) {
+    PromiseResult *promise = vat->promises.find(pid);
+    if (!promise) {
+      continue;
     }
+
+    auto &deps = promise->dependents;
+    deps.erase(std::remove(deps.begin(), deps.end(), dpf), deps.end());
   }
+}
 
-  pop_scope(context);
+// Frees what a promise no longer needs once it has resolved or been rejected.
+// Dependents that fired were freed as they fired, the rest are still listed by
+// the promises they wait on.
+void settle_promise(Vat *vat, PromiseResult *promise) {
+  if (promise->has_timer) {
+    cancel_timer(promise->timer_id);
+    promise->has_timer = false;
+  }
 
-  return make_nop();
+  for (auto cb : promise->callbacks) {
+    delete cb;
+  }
+  promise->callbacks.clear();
+  promise->dependents.clear();
 }
 
-void on_promise_do(EvalContext* context, int promise_id, std::vector<AstNode*> body) {
-  context->vat->promises[promise_id].callbacks.push_back((PromiseResNode *)make_promise_resolution_node("anon", body));
+bool reject_promise(Vat *vat, int promise_id) {
+  PromiseResult *promise = vat->promises.find(promise_id);
+  if (!promise || promise->resolved || promise->rejected) {
+    return false;
+  }
+
+  promise->rejected = true;
+
+  dbp(log_debug, "Rejected promise %d", promise_id);
+
+  // Whoever is waiting on our return value is rejected too
+  if (promise->return_msg && promise->msg.method_id != MAIN_METHOD) {
+    vat->out_messages.push(create_rejection(promise->msg));
+  }
+
+  // Messages waiting on this promise can never be sent, so the promises they
+  // would have resolved are rejected in turn
+  std::vector<DependPromFunc *> dependents;
+  dependents.swap(promise->dependents);
+  std::sort(dependents.begin(), dependents.end());
+  dependents.erase(std::unique(dependents.begin(), dependents.end()), dependents.end());
+
+  for (auto dpf : dependents) {
+    unlink_dependent(vat, dpf);
+    reject_promise(vat, dpf->promise_id);
+    delete dpf;
+  }
+
+  settle_promise(vat, promise);
+  return true;
 }
 
-Entity *resolve_local_entity(EvalContext *context, EntityRefNode *entity_ref) {
+Entity *resolve_local_entity(EvalContext *context, const Value &entity_ref) {
   //printf("Resolving local entity: %d %d %d\n", entity_ref->entity_id, entity_ref->vat_id, entity_ref->node_id);
   // FIXME - self fix
-  if (entity_ref->entity_id == -1 && entity_ref->vat_id == -1 && entity_ref->node_id == -1) {
+  if (entity_ref.ref.entity_id == -1 && entity_ref.ref.vat_id == -1 && entity_ref.node_id == -1) {
     return context->stack.back().entity;
+  }
+
+  // Calls on the running entity skip the lookup.  list-pmap workers depend
+  // on it, their scratch vats hold no entities.
+  Entity *current = context->stack.empty() ? nullptr : context->stack.back().entity;
+  if (current && entity_ref.ref.entity_id == current->address.entity_id && entity_ref.ref.vat_id == current->address.vat_id &&
+      entity_ref.node_id == current->address.node_id) {
+    return current;
   } else {
-    auto found_ent = context->vat->entities.find(entity_ref->entity_id);
-    assert(found_ent != context->vat->entities.end());
+    Entity *found_ent = find_entity(context->vat, entity_ref.ref.entity_id);
+    if (!found_ent) {
+      panic("Stale entity reference " + std::to_string(entity_ref.ref.entity_id) + " in vat " + std::to_string(context->vat->id));
+    }
 
-    return found_ent->second;
+    return found_ent;
   }
 }
 
-AstNode *eval_promise_local(EvalContext *context, Entity *entity,
+Value eval_promise_local(EvalContext *context, Entity *entity,
                             PromiseResult *resolve_node, int promise_id) {
 
-  AstNode* ret;
+  Value ret;
   int iz = 0;
   for (auto &cb : resolve_node->callbacks) {
-    std::vector<std::tuple<std::string, AstNode *>> subs;
-    for (int i = 0; i < resolve_node->results.size(); ++i) {
-      subs.push_back(std::make_tuple(cb->sym, resolve_node->results[i]));
+    push_stack_frame(context, cfs(context).entity, cfs(context).module, nullptr);
+    cfs(context).locals.resize(cb->frame_size);
+    if (!resolve_node->results.empty()) {
+      cfs(context).locals[0] = resolve_node->results.back();
     }
 
-    ret = eval_block(context, cb->body, subs);
+    if (engine == Engine::Bytecode) {
+      ret = run_chunk(context, cb->chunk);
+    } else {
+      ret = eval_block(context, cb->body);
+    }
+    pop_stack_frame(context);
 
     iz++;
   }
@@ -107,23 +204,23 @@ AstNode *eval_promise_local(EvalContext *context, Entity *entity,
     //printf("Executing dependent %d from %d\n", k, promise_id);
     // Actually, just manually send our own message here without calling eval_message_node.  that way we can control the promise id
     if (k->target_depends_on == promise_id) {
-      assert(resolve_node->results[0]->type == AstNodeType::EntityRefNode);
-      EntityRefNode *entity_ref = (EntityRefNode*)resolve_node->results[0];
-      k->target.node_id = entity_ref->node_id;
-      k->target.vat_id = entity_ref->vat_id;
-      k->target.entity_id = entity_ref->entity_id;
+      const Value &entity_ref = resolve_node->results[0];
+      assert(entity_ref.tag == ValueTag::EntityRef);
+      k->target.node_id = entity_ref.node_id;
+      k->target.vat_id = entity_ref.ref.vat_id;
+      k->target.entity_id = entity_ref.ref.entity_id;
       printf("Got dependent entity target\n");
     } else {
       assert(k->depends_on.find(promise_id) != k->depends_on.end());
       int arg_ind = k->depends_on[promise_id];
       printf("Satisfy arg %d with prom id %d (%d, %d)\n", arg_ind, promise_id, k->args.size(), resolve_node->results.size());
-      k->args[arg_ind] = resolve_node->results[0];
+      k->args[arg_ind] = copy_msg_value(resolve_node->results[0]);
     }
 
     // Message guard
     bool message_ready = true;
     for (auto &zz : k->args) {
-      if (!zz) message_ready = false;
+      if (!value_bound(zz)) message_ready = false;
     }
     if (k->target.node_id == -1) {
       message_ready = false;
@@ -134,57 +231,139 @@ AstNode *eval_promise_local(EvalContext *context, Entity *entity,
     }
     /////////
 
-    printf("Message ready, firing message: %s!\n", k->function_name.c_str());
+    printf("Message ready, firing message: %s!\n", method_name(k->method_id).c_str());
 
     Msg m;
 
     set_msg_target(&m, k->target);
     set_msg_src(&m, cfs(context).entity->address);
 
-    m.function_name = k->function_name;
-
-    for (auto varg : k->args) {
-      m.values.push_back((ValueNode *)varg);
-    }
+    m.method_id = k->method_id;
 
+    m.values = k->args;
     m.promise_id = k->promise_id;
 
     context->vat->out_messages.push(m);
+
+    // Every promise it waited on has resolved and dropped it
+    delete k;
   }
 
   return ret;
 }
 
-AstNode *eval_func_local(EvalContext *context, Entity *entity, std::string function_name, std::vector<AstNode *> args) {
-
-  auto func = entity->entity_def->functions.find(function_name);
-  if(func == entity->entity_def->functions.end()) {
-    std::string msg = "Attempted to call function '" + function_name + "' on entity '" + entity->entity_def->name + "': function not found.";
+FuncStmt *find_method(EntityDef *entity_def, MethodId method_id) {
+  auto func = entity_def->methods.find(method_id);
+  if (func == entity_def->methods.end()) {
+    std::string msg = "Attempted to call function '" + method_name(method_id) + "' on entity '" + entity_def->name + "': function not found.";
     throw PleromaException(msg.c_str());
   }
 
-  FuncStmt *func_def_node = (FuncStmt *)func->second;
-  if (func_def_node->args.size() != args.size()) {
-    throw PleromaException(std::string("Runtime error: Amount of arguments in function " + entity->entity_def->name + "::" + function_name +  " doesn't match in eval_func_local. Expected " + std::to_string(func_def_node->args.size()) + ", but got " + std::to_string(args.size())).c_str());
+  return func->second;
+}
+
+// False if an argument can't be part of a key
+bool make_memo_key(FuncStmt *func, const Value *args, int argc, MemoKey *key) {
+  key->func = func;
+  for (int i = 0; i < argc; ++i) {
+    if (args[i].tag == ValueTag::Number) {
+      key->args.push_back(args[i].number);
+    } else if (args[i].tag == ValueTag::Boolean) {
+      key->args.push_back(args[i].boolean);
+    } else {
+      return false;
+    }
+    key->args.push_back((s64)args[i].tag);
+  }
+  return true;
+}
+
+// Objects belong to the vat's GC and may be written to, only immediates are kept
+void memo_store(MemoCache *memo, const MemoKey &key, const Value &result) {
+  if (result.tag != ValueTag::Number && result.tag != ValueTag::Boolean && result.tag != ValueTag::Nop) {
+    return;
+  }
+
+  if (memo->order.size() >= memo_size) {
+    memo->results.erase(memo->order.front());
+    memo->order.pop_front();
+  }
+  memo->results[key] = result;
+  memo->order.push_back(key);
+}
+
+Value call_method(EvalContext *context, Entity *entity, FuncStmt *func, const Value *args, int argc) {
+  if (func->args.size() != argc) {
+    throw PleromaException(std::string("Runtime error: Amount of arguments in function " + entity->entity_def->name + "::" + func->name +  " doesn't match in eval_func_local. Expected " + std::to_string(func->args.size()) + ", but got " + std::to_string(argc)).c_str());
+  }
+
+  if (func->frame_size < 0) {
+    panic("Function " + entity->entity_def->name + "::" + func->name + " was never resolved");
   }
 
-  std::vector<std::tuple<std::string, AstNode *>> subs;
-  for (int i = 0; i < func_def_node->args.size(); ++i) {
-    subs.push_back(std::make_tuple(func_def_node->args[i], eval(context, args[i])));
+  // Pure functions may still reach side effects through builtins such as
+  // timers or list-map, parallel_safe ones can't, so equal arguments give an
+  // equal result and skipping the call changes nothing else
+  MemoKey key;
+  bool memoize = memo_size > 0 && func->parallel_safe && make_memo_key(func, args, argc, &key);
+  if (memoize) {
+    MemoCache &memo = context->vat->memo;
+    auto found = memo.results.find(key);
+    if (found != memo.results.end()) {
+      memo.hits++;
+      return found->second;
+    }
+    memo.misses++;
   }
 
-  push_stack_frame(context, entity, entity->entity_def->module, function_name);
+  // Arguments take the first slots.  They may live on the VM stack, so they're
+  // copied before the body runs.
+  push_stack_frame(context, entity, entity->entity_def->module, func);
+  auto &locals = cfs(context).locals;
+  locals.assign(args, args + argc);
+  locals.resize(func->frame_size);
 
-  auto res = eval_block(context, func_def_node->body, subs);
+  Value res;
+  if (engine == Engine::Bytecode) {
+    res = run_chunk(context, func->chunk);
+  } else {
+    res = eval_block(context, func->body);
+  }
 
   pop_stack_frame(context);
 
+  if (memoize) {
+    memo_store(&context->vat->memo, key, res);
+  }
+
   return res;
 }
 
-AstNode *eval_message_node(EvalContext *context, AstNode *node,
-                           CommMode comm_mode, std::string function_name,
-                           std::vector<AstNode *> args) {
+Value eval_func_local(EvalContext *context, Entity *entity, MethodId method_id, std::vector<Value> args) {
+  return call_method(context, entity, find_method(entity->entity_def, method_id), args.data(), args.size());
+}
+
+Value eval_call_site(EvalContext *context, MessageNode *site, const Value &target, const Value *args, int argc) {
+  if (target.tag != ValueTag::EntityRef) {
+    panic("Expected an entity ref, but got " + value_tag_to_string(target.tag));
+  }
+  Entity *entity = resolve_local_entity(context, target);
+  assert(entity != nullptr);
+
+  // Sites are shared by every vat running the module, so a racing miss just
+  // stores another valid entry
+  FuncStmt *func = site->cached_func.load(std::memory_order_relaxed);
+  if (!func || func->entity_def != entity->entity_def) {
+    func = find_method(entity->entity_def, site->method_id);
+    site->cached_func.store(func, std::memory_order_relaxed);
+  }
+
+  return call_method(context, entity, func, args, argc);
+}
+
+Value eval_message_node(EvalContext *context, const Value &node,
+                           CommMode comm_mode, MethodId method_id,
+                           std::vector<Value> args) {
 
   // 1. Determine what type of Entity we have - local, far, alien
   // 2. Determine if the call will be sync/async and if we care about the result
@@ -194,31 +373,37 @@ AstNode *eval_message_node(EvalContext *context, AstNode *node,
   //printf("Eval msg node : %d %d %d\n", entity_ref->node_id, entity_ref->vat_id, entity_ref->entity_id);
 
   if (comm_mode == CommMode::Sync) {
-    EntityRefNode *entity_ref = safe_ncast<EntityRefNode*>(node, AstNodeType::EntityRefNode);
+    if (node.tag != ValueTag::EntityRef) {
+      panic("Expected an entity ref, but got " + value_tag_to_string(node.tag));
+    }
     Entity *target_entity;
-    target_entity = resolve_local_entity(context, entity_ref);
+    target_entity = resolve_local_entity(context, node);
     //printf("%d %d %d\n", target_entity->address.node_id, target_entity->address.vat_id, target_entity->address.entity_id);
     //printf("%s %s\n", target_entity->entity_def->name.c_str(), function_name.c_str());
     assert(target_entity != nullptr);
-    return eval_func_local(context, target_entity, function_name, args);
+    return eval_func_local(context, target_entity, method_id, args);
   } else {
 
-    EntityRefNode *entity_ref;
+    Value entity_ref;
     bool promise_ent_address = true;
     bool promise_args = false;
     int pid = new_promise(context);
 
-    if (node->type == AstNodeType::EntityRefNode) {
-      entity_ref = (EntityRefNode *)node;
+    if (node.tag == ValueTag::EntityRef) {
+      entity_ref = node;
       promise_ent_address = false;
-    } else if (node->type == AstNodeType::PromiseNode) {
-      PromiseNode* prom_node = safe_ncast<PromiseNode*>(node, AstNodeType::PromiseNode);
-      auto res = context->vat->promises.find(prom_node->promise_id);
-      assert(res != context->vat->promises.end());
-
-      if (res->second.resolved) {
-        assert(res->second.results[0]->type == AstNodeType::EntityRefNode);
-        entity_ref = (EntityRefNode*)res->second.results[0];
+    } else if (node.tag == ValueTag::Promise) {
+      PromiseResult *res = context->vat->promises.find(node.promise_id);
+      assert(res);
+
+      if (res->rejected) {
+        reject_promise(context->vat, pid);
+        return make_promise_value(pid);
+      }
+
+      if (res->resolved) {
+        assert(res->results[0].tag == ValueTag::EntityRef);
+        entity_ref = res->results[0];
         promise_ent_address = false;
       }
     } else {
@@ -226,36 +411,54 @@ AstNode *eval_message_node(EvalContext *context, AstNode *node,
     }
 
     for (auto &zrk : args) {
-      if (zrk->type == AstNodeType::PromiseNode) {
-        promise_args = true;
+      if (zrk.tag == ValueTag::Promise) {
+        PromiseResult *res = context->vat->promises.find(zrk.promise_id);
+        assert(res);
+
+        // Settled promises never fire their dependents again
+        if (res->rejected) {
+          reject_promise(context->vat, pid);
+          return make_promise_value(pid);
+        }
+
+        if (res->resolved) {
+          zrk = res->results[0];
+        } else {
+          promise_args = true;
+        }
+      }
+
+      // The receiver may be on another burner, so it gets its own copy
+      if (zrk.tag != ValueTag::Promise) {
+        zrk = copy_msg_value(zrk);
       }
     }
 
     if (promise_ent_address || promise_args) {
       DependPromFunc *dpf = new DependPromFunc;
       dpf->promise_id = pid;
-      dpf->function_name = function_name;
+      dpf->method_id = method_id;
 
       if (promise_ent_address) {
-        PromiseNode *prom_node = (PromiseNode *)node;
-        assert(context->vat->promises.find(prom_node->promise_id) != context->vat->promises.end());
-        context->vat->promises[prom_node->promise_id].dependents.push_back(dpf);
+        PromiseResult *target_promise = context->vat->promises.find(node.promise_id);
+        assert(target_promise);
+        target_promise->dependents.push_back(dpf);
         dpf->target.node_id = -1;
-        dpf->target_depends_on = prom_node->promise_id;
+        dpf->target_depends_on = node.promise_id;
       } else {
-        dpf->target.node_id = entity_ref->node_id;
-        dpf->target.vat_id = entity_ref->vat_id;
-        dpf->target.entity_id = entity_ref->entity_id;
+        dpf->target.node_id = entity_ref.node_id;
+        dpf->target.vat_id = entity_ref.ref.vat_id;
+        dpf->target.entity_id = entity_ref.ref.entity_id;
       }
 
       // Copy in args we have, stick promises for ones we don't
       for (int i = 0; i < args.size(); ++i) {
-        if (args[i]->type != AstNodeType::PromiseNode) {
+        if (args[i].tag != ValueTag::Promise) {
           dpf->args.push_back(args[i]);
         } else {
-          auto argument_pid = ((PromiseNode *)args[i])->promise_id;
-          context->vat->promises[argument_pid].dependents.push_back(dpf);
-          dpf->args.push_back(nullptr);
+          auto argument_pid = args[i].promise_id;
+          context->vat->promises.find(argument_pid)->dependents.push_back(dpf);
+          dpf->args.push_back(Value());
           dpf->depends_on[argument_pid] = i;
           printf("Argument %d depends on %d", argument_pid, i);
         }
@@ -264,20 +467,17 @@ AstNode *eval_message_node(EvalContext *context, AstNode *node,
     } else {
       Msg m;
 
-      set_msg_target(&m, *entity_ref);
+      set_msg_target(&m, entity_ref);
       set_msg_src(&m, cfs(context).entity->address);
 
-      m.function_name = function_name;
+      m.method_id = method_id;
       m.promise_id = pid;
-
-      for (auto varg : args) {
-        m.values.push_back((ValueNode *)varg);
-      }
+      m.values = args;
 
       context->vat->out_messages.push(m);
     }
 
-    return make_promise_node(pid);
+    return make_promise_value(pid);
 
   }
 
@@ -286,6 +486,59 @@ AstNode *eval_message_node(EvalContext *context, AstNode *node,
   panic("Unhandled message node");
 }
 
+bool is_string(const Value &value) {
+  return value.tag == ValueTag::Object && (value.object->type == AstNodeType::StringNode || value.object->type == AstNodeType::RopeNode);
+}
+
+// Unboxed elements are immediates and stay shared, boxed ones are copied
+// one by one
+AstNode *copy_msg_list(ListNode *list) {
+  auto copy = (ListNode *)share_list(list);
+  if (list->elements == ValueTag::Object) {
+    std::vector<AstNode *> elements;
+    for (auto k : list->list) {
+      Value element = copy_msg_value(make_value(k));
+      elements.push_back(make_value_node(element));
+    }
+    copy->list = elements;
+  }
+  return copy;
+}
+
+Value copy_msg_value(const Value &value) {
+  if (value.tag == ValueTag::Number || value.tag == ValueTag::Boolean || value.tag == ValueTag::EntityRef) {
+    return value;
+  } else if (is_string(value)) {
+    return make_object_value(make_string(extract_string(value.object)));
+  } else if (value.tag == ValueTag::Object && value.object->type == AstNodeType::ListNode) {
+    return make_object_value(copy_msg_list((ListNode *)value.object));
+  }
+
+  panic("Unhandled message value : " + value_tag_to_string(value.tag));
+}
+
+void adopt_msg_value(Vat *vat, const Value &value) {
+  if (value.tag != ValueTag::Object) {
+    return;
+  }
+
+  vat->all_objects.push_back(value.object);
+  if (value.object->type == AstNodeType::ListNode) {
+    auto list = (ListNode *)value.object;
+    if (list->elements == ValueTag::Object) {
+      for (auto k : list->list) {
+        adopt_msg_value(vat, make_object_value(k));
+      }
+    }
+  }
+}
+
+void adopt_msg_values(Vat *vat, const std::vector<Value> &values) {
+  for (auto &value : values) {
+    adopt_msg_value(vat, value);
+  }
+}
+
 void register_gc_obj(EvalContext *context, AstNode* obj) {
   context->vat->all_objects.push_back(obj);
 }
@@ -293,33 +546,582 @@ void register_gc_obj(EvalContext *context, AstNode* obj) {
 //void register_gc_ent(EvalContext *context, Entity *ent) {
 //}
 
-AstNode *eval(EvalContext *context, AstNode *obj) {
+void flatten_strings(EvalContext *context, std::vector<Value> &args) {
+  for (auto &arg : args) {
+    if (arg.tag == ValueTag::Object && arg.object->type == AstNodeType::RopeNode) {
+      auto flat = make_string(extract_string(arg.object));
+      register_gc_obj(context, flat);
+      arg = make_object_value(flat);
+    }
+  }
+}
+
+AstNode *box_value(EvalContext *context, const Value &value) {
+  auto node = make_value_node(value);
+  if (node && value.tag != ValueTag::Object) {
+    register_gc_obj(context, node);
+  }
+  return node;
+}
+
+void box_list(EvalContext *context, ListNode *list) {
+  if (list->elements == ValueTag::Object) {
+    return;
+  }
+
+  std::vector<AstNode *> boxed;
+  for (size_t i = 0; i < list->numbers.size(); ++i) {
+    boxed.push_back(box_value(context, list_get(list, i)));
+  }
+  list->list = boxed;
+  list->numbers = CowVector<s64>();
+  list->elements = ValueTag::Object;
+}
+
+void list_push(EvalContext *context, ListNode *list, const Value &value) {
+  if (!list_fits(list, value)) {
+    box_list(context, list);
+  }
+
+  if (list->elements == ValueTag::Object) {
+    list->list.push_back(box_value(context, value));
+  } else {
+    list->elements = value.tag;
+    list->numbers.push_back(value.tag == ValueTag::Number ? value.number : value.boolean);
+  }
+}
+
+void list_set(EvalContext *context, ListNode *list, size_t index, const Value &value) {
+  if (!list_fits(list, value)) {
+    box_list(context, list);
+  }
+
+  if (list->elements == ValueTag::Object) {
+    list->list.set(index, box_value(context, value));
+  } else {
+    list->numbers.set(index, value.tag == ValueTag::Number ? value.number : value.boolean);
+  }
+}
+
+AstNode *list_from_values(EvalContext *context, const ArenaVector<Value> &values, CType *ctype) {
+  auto list = (ListNode *)make_list({}, ctype);
+  for (auto &value : values) {
+    list_push(context, list, value);
+  }
+  return list;
+}
+
+Value eval_number_operator(OperatorExpr::Op op, s64 left, s64 right) {
+  switch (op) {
+  case OperatorExpr::Plus:
+    return make_number_value(left + right);
+  case OperatorExpr::Minus:
+    return make_number_value(left - right);
+  case OperatorExpr::Times:
+    return make_number_value(left * right);
+  case OperatorExpr::Divide:
+    if (right == 0) {
+      throw PleromaException("Division by zero");
+    }
+    return make_number_value(left / right);
+  }
+
+  assert(false);
+}
+
+Value eval_concat(EvalContext *context, const Value &left, const Value &right, bool frame_local) {
+  // Short results are copied, longer ones share both sides so appending in a
+  // loop stays linear
+  AstNode *tmp_str;
+  if (string_length(left.object) + string_length(right.object) <= MIN_ROPE_LENGTH) {
+    tmp_str = make_string(extract_string(left.object) + extract_string(right.object));
+  } else {
+    tmp_str = make_rope(left.object, right.object);
+  }
+
+  if (frame_local) {
+    cfs(context).frame_objects.push_back(tmp_str);
+  } else {
+    register_gc_obj(context, tmp_str);
+  }
+  return make_object_value(tmp_str);
+}
+
+Value eval_operator(EvalContext *context, OperatorExpr::Op op, const Value &n1, const Value &n2) {
+  if (n1.tag == ValueTag::Number && n2.tag == ValueTag::Number) {
+    return eval_number_operator(op, n2.number, n1.number);
+  } else if (is_string(n1) && is_string(n2) && op == OperatorExpr::Plus) {
+    return eval_concat(context, n2, n1, false);
+  }
+
+  panic("Unsupported operator on " + value_tag_to_string(n1.tag));
+}
+
+Value eval_number_comparison(BooleanExpr::Op op, s64 left, s64 right) {
+  switch (op) {
+  case BooleanExpr::GreaterThan:
+    return make_boolean_value(left > right);
+  case BooleanExpr::LessThan:
+    return make_boolean_value(left < right);
+  case BooleanExpr::GreaterThanEqual:
+    return make_boolean_value(left >= right);
+  case BooleanExpr::LessThanEqual:
+    return make_boolean_value(left <= right);
+  case BooleanExpr::Equals:
+    return make_boolean_value(left == right);
+  }
+
+  assert(false);
+}
+
+Value eval_string_equals(const Value &left, const Value &right) {
+  // Ropes are flattened, plain strings compare in place
+  if (left.object->type == AstNodeType::StringNode && right.object->type == AstNodeType::StringNode) {
+    return make_boolean_value(((StringNode *)left.object)->value == ((StringNode *)right.object)->value);
+  }
+  return make_boolean_value(extract_string(left.object) == extract_string(right.object));
+}
+
+Value eval_comparison(BooleanExpr::Op op, const Value &term1, const Value &term2) {
+  if (op == BooleanExpr::Equals) {
+    if (is_string(term1) && is_string(term2)) {
+      return eval_string_equals(term1, term2);
+    } else if (term1.tag != ValueTag::Number || term2.tag != ValueTag::Number) {
+      panic("Unsupported comparison on " + value_tag_to_string(term1.tag));
+    }
+  }
+
+  return eval_number_comparison(op, value_number(term1), value_number(term2));
+}
+
+Value eval_index(const Value &list, const Value &accessor) {
+  ListNode *list_node = value_ncast<ListNode*>(list, AstNodeType::ListNode);
+  auto index = value_number(accessor);
+
+  if (index >= list_size(list_node)) {
+    printf("%ld\n", (long)index);
+    throw PleromaException("Attempted to access array out of bounds.");
+  }
+  return list_get(list_node, index);
+}
+
+void store_index(EvalContext *context, const Value &list, const Value &accessor, const Value &value) {
+  ListNode *list_node = value_ncast<ListNode*>(list, AstNodeType::ListNode);
+  list_set(context, list_node, value_number(accessor), value);
+}
+
+Value eval_range(const Value &range_start, const Value &range_end) {
+  std::vector<s64> new_list;
+  for (s64 i = value_number(range_start); i < value_number(range_end); i++) {
+    new_list.push_back(i);
+  }
+
+  // FIXME alloc
+  CType *ctype = new CType;
+  ctype->basetype = PType::List;
+  ctype->subtype = lu8();
+  ctype->dtype = DType::Local;
+
+  return make_object_value(make_unboxed_list(new_list, ValueTag::Number, ctype));
+}
+
+ForIter make_range_iter(const Value &range_start, const Value &range_end) {
+  ForIter iter;
+  iter.next = value_number(range_start);
+  iter.end = value_number(range_end);
+  return iter;
+}
+
+ForIter make_list_iter(const Value &list) {
+  ForIter iter;
+  iter.list = value_ncast<ListNode *>(list, AstNodeType::ListNode);
+  return iter;
+}
+
+bool for_iter_next(ForIter *iter, Value *value) {
+  if (iter->list) {
+    // The body may append to the list, so its size is checked every time
+    if (iter->next >= list_size(iter->list)) {
+      return false;
+    }
+    *value = list_get(iter->list, iter->next++);
+    return true;
+  }
+
+  if (iter->next >= iter->end) {
+    return false;
+  }
+  *value = make_number_value(iter->next++);
+  return true;
+}
+
+// FIXME only handles strings, numbers and booleans
+bool match_case_equal(const Value &mexpr, const Value &mca_eval) {
+  if (is_string(mexpr)) {
+    if (!is_string(mca_eval)) {
+      panic("Expected a string, but got " + stringify_value(mca_eval));
+    }
+    return extract_string(mexpr.object) == extract_string(mca_eval.object);
+  } else if (mexpr.tag == ValueTag::Number) {
+    return mexpr.number == value_number(mca_eval);
+  } else if (mexpr.tag == ValueTag::Boolean) {
+    return mexpr.boolean == value_boolean(mca_eval);
+  }
+
+  assert(false);
+}
+
+int match_table_case(MatchNode *node, const Value &mexpr) {
+  if (node->table_tag == ValueTag::Object) {
+    if (!is_string(mexpr)) {
+      panic("Expected a string, but got " + stringify_value(mexpr));
+    }
+    auto found = node->string_table.find(extract_string(mexpr.object));
+    if (found != node->string_table.end()) {
+      return found->second;
+    }
+  } else {
+    if (mexpr.tag != node->table_tag) {
+      panic("Expected a " + value_tag_to_string(node->table_tag) + ", but got " + stringify_value(mexpr));
+    }
+    auto found = node->number_table.find(mexpr.tag == ValueTag::Number ? mexpr.number : mexpr.boolean);
+    if (found != node->number_table.end()) {
+      return found->second;
+    }
+  }
+
+  return node->default_case;
+}
+
+Value eval_create_entity(EvalContext *context, CreateEntityNode *node) {
+  auto creation_ast = cfs(context).module->entity_defs.find(node->entity_def_name);
+
+  if (creation_ast == cfs(context).module->entity_defs.end()) {
+    for (auto &[zz, _] : cfs(context).module->entity_defs) {
+      printf("%s\n", zz.c_str());
+    }
+    panic("Failed to find " + node->entity_def_name);
+  }
+
+  if (node->new_vat) {
+    return promise_new_vat(context, (EntityDef *)creation_ast->second);
+  } else {
+    Entity *ent = create_entity(context, (EntityDef *)creation_ast->second, node->new_vat);
+    return make_entity_ref_value(ent->address.node_id, ent->address.vat_id, ent->address.entity_id);
+  }
+}
+
+Value eval_on_resolve(EvalContext *context, PromiseResNode *node, const Value &prom_sym) {
+  PromiseResult *promise = context->vat->promises.find(value_promise(prom_sym));
+  assert(promise);
+
+  // If available, run now, else stuff the promise into the Promise stack -
+  // will be resolved + run by VM
+  if (promise->resolved) {
+    assert(false);
+    // return eval(context, promise->result);
+  }
+
+  // Callbacks are freed with the promise, so it gets its own node
+  promise->callbacks.push_back(new PromiseResNode(*node));
+  return make_object_value(node);
+}
+
+// Pushes a frame for the imported module, the caller pops it
+void enter_module(EvalContext *context, const std::string &mod_name) {
+  // User modules are imported by name, system modules under sys
+  auto &imports = cfs(context).module->imports;
+  auto find_mod = imports.find(mod_name);
+  if (find_mod == imports.end()) {
+    find_mod = imports.find("sys►" + mod_name);
+  }
+
+  //for (auto &k : cfs(context).module->imports) {
+  //  printf("mod import %s\n", k.first.c_str());
+  //}
+  printf("Inside mod %s\n", mod_name.c_str());
+
+  assert(find_mod != imports.end());
+
+  push_stack_frame(context, cfs(context).entity, find_mod->second, nullptr);
+}
+
+bool is_builtin(MethodId method_id) {
+  return method_id == APPEND_METHOD || method_id == LEN_METHOD || method_id == AFTER_METHOD || method_id == EVERY_METHOD ||
+         method_id == CANCEL_TIMER_METHOD || method_id == PROMISE_TIMEOUT_METHOD || method_id == CANCEL_PROMISE_METHOD ||
+         method_id == LIST_SUM_METHOD || method_id == LIST_MIN_METHOD || method_id == LIST_MAX_METHOD || method_id == LIST_FIND_METHOD ||
+         method_id == LIST_MAP_METHOD || method_id == LIST_FILTER_METHOD || method_id == LIST_PMAP_METHOD;
+}
+
+// The loops run straight over the unboxed numbers so the compiler can
+// vectorize them.  Boxed lists are unboxed into a scratch copy first.
+Value eval_list_scan(MethodId method_id, ListNode *list_node, ArenaVector<Value> &args) {
+  std::vector<s64> scratch;
+  const s64 *numbers;
+  size_t n = list_size(list_node);
+  if (list_node->elements != ValueTag::Object) {
+    numbers = n ? &list_node->numbers[0] : nullptr;
+  } else {
+    for (size_t i = 0; i < n; ++i) {
+      scratch.push_back(value_number(list_get(list_node, i)));
+    }
+    numbers = scratch.data();
+  }
+
+  if (method_id == LIST_SUM_METHOD) {
+    s64 sum = 0;
+    for (size_t i = 0; i < n; ++i) {
+      sum += numbers[i];
+    }
+    return make_number_value(sum);
+  }
+
+  if (method_id == LIST_FIND_METHOD) {
+    // The index of the first match, or the list's length if there's none
+    s64 needle = value_number(args[1]);
+    size_t i = 0;
+    for (; i < n; ++i) {
+      if (numbers[i] == needle) break;
+    }
+    return make_number_value(i);
+  }
+
+  if (n == 0) {
+    throw PleromaException("Attempted to take the min or max of an empty list.");
+  }
+
+  s64 best = numbers[0];
+  if (method_id == LIST_MIN_METHOD) {
+    for (size_t i = 1; i < n; ++i) {
+      best = numbers[i] < best ? numbers[i] : best;
+    }
+  } else {
+    for (size_t i = 1; i < n; ++i) {
+      best = numbers[i] > best ? numbers[i] : best;
+    }
+  }
+  return make_number_value(best);
+}
+
+// Maps func over a list of numbers or booleans in chunks on the worker pool.
+// Each chunk runs in a context and vat of its own, objects the function makes
+// are dropped with them, so only immediates may come back.
+AstNode *eval_parallel_map(EvalContext *context, Entity *entity, FuncStmt *func, ListNode *list_node) {
+  size_t n = list_size(list_node);
+  ArenaVector<Value> results(n, Value(), context->arena);
+
+  std::atomic<u64> reductions{0};
+  std::mutex error_mtx;
+  std::string error;
+
+  parallel_for((n + PMAP_CHUNK - 1) / PMAP_CHUNK, [&](int chunk) {
+    Vat scratch;
+    EvalContext worker;
+    start_context(&worker, context->node, &scratch, entity->entity_def->module, entity);
+
+    try {
+      for (size_t i = chunk * PMAP_CHUNK; i < n && i < (chunk + 1) * PMAP_CHUNK; ++i) {
+        Value elem = list_get(list_node, i);
+        results[i] = call_method(&worker, entity, func, &elem, 1);
+        if (results[i].tag == ValueTag::Object) {
+          throw PleromaException(("list-pmap: " + func->name + " must return numbers or booleans").c_str());
+        }
+      }
+    } catch (PleromaException &e) {
+      std::lock_guard<std::mutex> lock(error_mtx);
+      error = e.what();
+    }
+
+    reductions += worker.reductions;
+    for (auto obj : scratch.all_objects) {
+      destroy_ast_obj(obj);
+    }
+  });
+
+  context->reductions += reductions;
+  if (!error.empty()) {
+    throw PleromaException(error.c_str());
+  }
+
+  return list_from_values(context, results, list_node->ctype.subtype);
+}
+
+// Builtins shadow every entity's methods.  Returns false if method_id isn't
+// one of them.
+bool eval_builtin(EvalContext *context, MethodId method_id, ArenaVector<Value> &args, Value *result) {
+  if (method_id == APPEND_METHOD) {
+    auto list_node = value_ncast<ListNode *>(args[0], AstNodeType::ListNode);
+    list_push(context, list_node, args[1]);
+    *result = make_nop_value();
+    return true;
+  }
+
+  if (method_id == LEN_METHOD) {
+    auto list_node = value_ncast<ListNode *>(args[0], AstNodeType::ListNode);
+    *result = make_number_value(list_size(list_node));
+    return true;
+  }
+
+  if (method_id == LIST_SUM_METHOD || method_id == LIST_MIN_METHOD || method_id == LIST_MAX_METHOD || method_id == LIST_FIND_METHOD) {
+    *result = eval_list_scan(method_id, value_ncast<ListNode *>(args[0], AstNodeType::ListNode), args);
+    return true;
+  }
+
+  // list-map(list, "function") / list-filter(list, "function") call a method
+  // of the calling entity on every element.  list-filter keeps those it
+  // returns #t or a non-zero number for.  list-pmap is list-map across the
+  // worker pool, for parallel_safe functions over numbers or booleans; it
+  // falls back to list-map for anything else.
+  if (method_id == LIST_MAP_METHOD || method_id == LIST_FILTER_METHOD || method_id == LIST_PMAP_METHOD) {
+    auto list_node = value_ncast<ListNode *>(args[0], AstNodeType::ListNode);
+    auto function_name = value_ncast<StringNode *>(args[1], AstNodeType::StringNode);
+    Entity *entity = cfs(context).entity;
+    FuncStmt *func = find_method(entity->entity_def, method_hash(function_name->value.c_str()));
+    if (!func) {
+      panic("Failed to find " + entity->entity_def->name + "::" + function_name->value);
+    }
+
+    if (method_id == LIST_PMAP_METHOD && func->parallel_safe && list_node->elements != ValueTag::Object &&
+        list_size(list_node) > PMAP_CHUNK) {
+      auto out = eval_parallel_map(context, entity, func, list_node);
+      register_gc_obj(context, out);
+      *result = make_object_value(out);
+      return true;
+    }
+
+    auto out = (ListNode *)make_list({}, list_node->ctype.subtype);
+    register_gc_obj(context, out);
+    // The list may be written to by the function, so it's walked by index
+    for (size_t i = 0; i < list_size(list_node); ++i) {
+      Value elem = list_get(list_node, i);
+      Value res = call_method(context, entity, func, &elem, 1);
+      if (method_id != LIST_FILTER_METHOD) {
+        list_push(context, out, res);
+      } else if (res.tag == ValueTag::Boolean ? res.boolean : value_number(res) != 0) {
+        list_push(context, out, elem);
+      }
+    }
+    *result = make_object_value(out);
+    return true;
+  }
+
+  // after(ms, entity, "function", args...) / every(...)
+  if (method_id == AFTER_METHOD || method_id == EVERY_METHOD) {
+    auto delay = value_number(args[0]);
+    if (args[1].tag != ValueTag::EntityRef) {
+      panic("Expected an entity ref, but got " + value_tag_to_string(args[1].tag));
+    }
+    auto function_name = value_ncast<StringNode *>(args[2], AstNodeType::StringNode);
+
+    Msg m;
+    set_msg_target(&m, args[1]);
+    m.src_node_id = -1;
+    m.src_vat_id = -1;
+    m.src_entity_id = -1;
+    m.promise_id = -1;
+    m.method_id = method_hash(function_name->value.c_str());
+
+    // The timer outlives this vat's GC cycles, so it keeps its own copies
+    for (int k = 3; k < args.size(); ++k) {
+      m.values.push_back(copy_msg_value(args[k]));
+    }
+
+    u64 interval = method_id == EVERY_METHOD ? delay : 0;
+    *result = make_number_value(add_timer(delay, interval, m));
+    return true;
+  }
+
+  if (method_id == CANCEL_TIMER_METHOD) {
+    *result = make_boolean_value(cancel_timer(value_number(args[0])));
+    return true;
+  }
+
+  // promise-timeout(promise, ms) rejects the promise unless it settles in time
+  if (method_id == PROMISE_TIMEOUT_METHOD) {
+    auto promise_id = value_promise(args[0]);
+    auto delay = value_number(args[1]);
+
+    PromiseResult *promise = context->vat->promises.find(promise_id);
+    if (!promise || promise->resolved || promise->rejected) {
+      *result = make_boolean_value(false);
+      return true;
+    }
+
+    if (promise->has_timer) {
+      cancel_timer(promise->timer_id);
+    }
+
+    // Comes back to us as an empty response
+    Msg m;
+    set_msg_target(&m, cfs(context).entity->address);
+    set_msg_src(&m, cfs(context).entity->address);
+    m.response = true;
+    m.promise_id = promise_id;
+    m.method_id = method_id;
+
+    promise->timer_id = add_timer(delay, 0, m);
+    promise->has_timer = true;
+    *result = make_boolean_value(true);
+    return true;
+  }
+
+  if (method_id == CANCEL_PROMISE_METHOD) {
+    *result = make_boolean_value(reject_promise(context->vat, value_promise(args[0])));
+    return true;
+  }
+
+  return false;
+}
+
+void assign_symbol(EvalContext *context, SymbolNode *sym, const Value &value) {
+  if (sym->scope == SymbolScope::Local) {
+    cfs(context).locals[sym->slot] = value;
+  } else if (sym->scope == SymbolScope::Field) {
+    cfs(context).entity->data[sym->slot] = value;
+  } else {
+    Value *find_it = find_symbol_table(context, sym->sym);
+    if (find_it) {
+      *find_it = value;
+    } else {
+      css(context).table[sym->sym] = value;
+    }
+  }
+}
+
+Value eval(EvalContext *context, AstNode *obj) {
+  context->reductions++;
+
+  if (obj->type == AstNodeType::SymbolNode) {
+    auto sym = (SymbolNode *)obj;
+
+    Value value;
+    if (sym->scope == SymbolScope::Local) {
+      value = cfs(context).locals[sym->slot];
+    } else if (sym->scope == SymbolScope::Field) {
+      value = cfs(context).entity->data[sym->slot];
+    }
+
+    // Unbound slots fall through for the error
+    return value_bound(value) ? value : find_symbol(context, sym->sym);
+  }
+
   if (obj->type == AstNodeType::AssignmentStmt) {
     auto ass_stmt = (AssignmentStmt *)obj;
 
-    AstNode* expr;
+    Value expr;
     SymbolNode *sym;
     if (ass_stmt->sym->type == AstNodeType::SymbolNode) {
       sym = ((SymbolNode*)ass_stmt->sym);
       expr = eval(context, ass_stmt->value);
 
-      std::map<std::string, AstNode *> *find_it = find_symbol_table(context, sym->sym);
-      if (find_it) {
-        (*find_it)[sym->sym] = expr;
-      } else {
-        css(context).table[sym->sym] = expr;
-      }
+      assign_symbol(context, sym, expr);
     } else if (ass_stmt->sym->type == AstNodeType::IndexNode) {
       IndexNode* ind_node = (IndexNode*) ass_stmt->sym;
       if (ind_node->list->type == AstNodeType::SymbolNode) {
         sym = ((SymbolNode *)ind_node->list);
         expr = eval(context, ass_stmt->value);
 
-        auto find_list = (ListNode*)find_symbol(context, sym->sym);
-        int index_value = ((NumberNode*)eval(context, ind_node->accessor))->value;
-
-        find_list->list[index_value] = expr;
-        expr = find_list->list[index_value];
+        store_index(context, eval(context, sym), eval(context, ind_node->accessor), expr);
 
       }
     } else {
@@ -335,20 +1137,13 @@ AstNode *eval(EvalContext *context, AstNode *obj) {
     auto n1 = eval(context, op_expr->term1);
     auto n2 = eval(context, op_expr->term2);
 
-    if (n1->type == AstNodeType::NumberNode && n2->type == AstNodeType::NumberNode) {
-      if (op_expr->op == OperatorExpr::Plus) {
-        auto tmp_nm = make_number(((NumberNode*)n1)->value + ((NumberNode*)n2)->value);
-        register_gc_obj(context, tmp_nm);
-        return tmp_nm;
-      }
-    } else if (n1->type == AstNodeType::StringNode && n2->type == AstNodeType::StringNode) {
-        if (op_expr->op == OperatorExpr::Plus) {
-          auto tmp_str = make_string(((StringNode *)n2)->value + ((StringNode *)n1)->value);
-          register_gc_obj(context, tmp_str);
-          return tmp_str;
-        }
-    } else{
-      assert(false);
+    switch (op_expr->operands) {
+    case OperandKind::Number:
+      return eval_number_operator(op_expr->op, n2.number, n1.number);
+    case OperandKind::String:
+      return eval_concat(context, n2, n1, op_expr->frame_local);
+    default:
+      return eval_operator(context, op_expr->op, n1, n2);
     }
   }
 
@@ -369,204 +1164,137 @@ AstNode *eval(EvalContext *context, AstNode *obj) {
     // FIXME
     // load_file(node->module + ".x");
 
-    return make_nop();
+    return make_nop_value();
   }
 
   if (obj->type == AstNodeType::ReturnNode) {
-    return obj;
+    return make_object_value(obj);
     // auto node = (ReturnNode*)obj;
     // return eval(node->expr, scope);
   }
 
   if (obj->type == AstNodeType::SelfNode) {
     auto eadd = cfs(context).entity->address;
-    return make_entity_ref(eadd.node_id, eadd.vat_id, eadd.entity_id);
-  }
-
-  if (obj->type == AstNodeType::CommentNode) {
-    return obj;
-  }
-
-  if (obj->type == AstNodeType::NumberNode) {
-    return obj;
+    return make_entity_ref_value(eadd.node_id, eadd.vat_id, eadd.entity_id);
   }
 
-  if (obj->type == AstNodeType::StringNode) {
-    return obj;
+  if (is_literal(obj)) {
+    return make_value(obj);
   }
 
   if (obj->type == AstNodeType::ListNode) {
     auto table = (ListNode *)obj;
 
-    for (int k = 0; k < table->list.size(); ++k) {
-      table->list[k] = eval(context, table->list[k]);
+    // The literal is left alone, each evaluation makes a new list.  A list of
+    // literals just shares them until it's written to.
+    bool all_literal = true;
+    for (auto elem : table->list) {
+      all_literal = all_literal && is_literal(elem);
+    }
+    if (all_literal) {
+      return make_object_value(share_list(table));
     }
 
-    return obj;
-  }
-
-  if (obj->type == AstNodeType::Nop) {
-    return obj;
-  }
-
-  if (obj->type == AstNodeType::TableNode) {
-    return obj;
+    ArenaVector<Value> elems(context->arena);
+    elems.reserve(table->list.size());
+    for (auto elem : table->list) {
+      elems.push_back(eval(context, elem));
+    }
+    return make_object_value(list_from_values(context, elems, table->ctype.subtype));
   }
 
   if (obj->type == AstNodeType::WhileStmt) {
     auto node = (WhileStmt *)obj;
 
-    while (((BooleanNode *)eval(context, node->generator))->value) {
-      eval_block(context, node->body, {});
+    while (value_boolean(eval(context, node->generator))) {
+      eval_block(context, node->body);
     }
 
-    return make_nop();
+    return make_nop_value();
   }
 
   if (obj->type == AstNodeType::ForStmt) {
     auto node = (ForStmt *)obj;
 
-    auto table = (ListNode *)eval(context, node->generator);
-
-    for (int k = 0; k < table->list.size(); ++k) {
-      // NOTE push k into sub
-      std::vector<std::tuple<std::string, AstNode *>> subs;
-      subs.push_back(std::make_tuple(node->sym, eval(context, table->list[k])));
-      eval_block(context, node->body, subs);
+    ForIter iter;
+    if (node->generator->type == AstNodeType::RangeNode) {
+      auto range_node = (RangeNode *)node->generator;
+      auto start_expr = eval(context, range_node->range_start);
+      iter = make_range_iter(start_expr, eval(context, range_node->range_end));
+    } else {
+      iter = make_list_iter(eval(context, node->generator));
     }
-    return make_nop();
-  }
 
-  if (obj->type == AstNodeType::BooleanNode) {
-    return obj;
+    Value elem;
+    while (for_iter_next(&iter, &elem)) {
+      cfs(context).locals[node->slot] = elem;
+      eval_block(context, node->body);
+    }
+    return make_nop_value();
   }
 
   if (obj->type == AstNodeType::IndexNode) {
     IndexNode* ind_node = (IndexNode*)obj;
-    assert(obj->type == AstNodeType::IndexNode);
-    ListNode* list_node = (ListNode*)eval(context, ind_node->list);
-    safe_ncast<ListNode*>(list_node, AstNodeType::ListNode);
-    assert(list_node->type == AstNodeType::ListNode);
-
-    auto index = ((NumberNode*)eval(context, ind_node->accessor))->value;
+    auto list_node = eval(context, ind_node->list);
+    auto index = eval(context, ind_node->accessor);
 
-    if (index >= list_node->list.size()) {
-      printf("%d\n", index);
-      throw PleromaException("Attempted to access array out of bounds.");
-    }
-    return list_node->list[index];
+    return eval_index(list_node, index);
   }
 
   if (obj->type == AstNodeType::BooleanExpr) {
     auto node = (BooleanExpr *)obj;
     auto term1 = eval(context, node->term1);
     auto term2 = eval(context, node->term2);
-    if (node->op == BooleanExpr::GreaterThan ||
-        node->op == BooleanExpr::LessThan ||
-        node->op == BooleanExpr::GreaterThanEqual ||
-        node->op == BooleanExpr::LessThanEqual) {
-
-      NumberNode *n1 = (NumberNode *)term1;
-      NumberNode *n2 = (NumberNode *)term2;
-
-      switch (node->op) {
-      case BooleanExpr::GreaterThan:
-        return make_boolean(n1->value > n2->value);
-        break;
-      case BooleanExpr::LessThan:
-        return make_boolean(n1->value < n2->value);
-        break;
-      case BooleanExpr::GreaterThanEqual:
-        return make_boolean(n1->value >= n2->value);
-        break;
-      case BooleanExpr::LessThanEqual:
-        return make_boolean(n1->value <= n2->value);
-        break;
-      }
-    }
 
-    if (node->op == BooleanExpr::Equals) {
-      if (term1->type == AstNodeType::NumberNode && term2->type == AstNodeType::NumberNode) {
-        NumberNode *n1 = (NumberNode *)term1;
-        NumberNode *n2 = (NumberNode *)term2;
-        return make_boolean(n1->value == n2->value);
-      } else if (term1->type == AstNodeType::StringNode && term2->type == AstNodeType::StringNode) {
-        StringNode *n1 = (StringNode *)term1;
-        StringNode *n2 = (StringNode *)term2;
-        return make_boolean(n1->value == n2->value);
-      } else {
-        assert(false);
-      }
+    switch (node->operands) {
+    case OperandKind::Number:
+      return eval_number_comparison(node->op, term1.number, term2.number);
+    case OperandKind::String:
+      return eval_string_equals(term1, term2);
+    default:
+      return eval_comparison(node->op, term1, term2);
     }
-
-    return make_boolean(false);
-  }
-
-  if (obj->type == AstNodeType::EntityDef) {
-    return obj;
   }
 
   if (obj->type == AstNodeType::MatchNode) {
     auto node = (MatchNode *)obj;
-    // FIXME only handles boolean
     auto mexpr = eval(context, node->match_expr);
 
-    for (auto match_case : node->cases) {
-      // TODO Make it so the order doesn't matter for fallthrough
-      if (std::get<0>(match_case)->type == AstNodeType::FallthroughExpr) {
-        return eval_block(context, std::get<1>(match_case), {});
-      } else {
-        auto mca_eval = eval(context, std::get<0>(match_case));
-
-        if (mexpr->type == AstNodeType::StringNode) {
-          auto sexpr = (StringNode*) mexpr;
-          auto sexpr_match = (StringNode *)mca_eval;
-          if (sexpr->value == sexpr_match->value) {
-            return eval_block(context, std::get<1>(match_case), {});
-          }
-        } else if (mexpr->type == AstNodeType::NumberNode) {
-          auto sexpr = (NumberNode *)mexpr;
-          auto sexpr_match = (NumberNode *)mca_eval;
-          if (sexpr->value == sexpr_match->value) {
-            return eval_block(context, std::get<1>(match_case), {});
-          }
-        } else if (mexpr->type == AstNodeType::BooleanNode) {
-          auto sexpr = safe_ncast<BooleanNode *>(mexpr, AstNodeType::BooleanNode);
-          auto sexpr_match = safe_ncast<BooleanNode *>(mca_eval, AstNodeType::BooleanNode);
-          if (sexpr->value == sexpr_match->value) {
-            return eval_block(context, std::get<1>(match_case), {});
-          }
-        } else {
-          assert(false);
+    int taken = node->default_case;
+    if (node->table_tag != ValueTag::Empty) {
+      taken = match_table_case(node, mexpr);
+    } else {
+      for (int k = 0; k < node->cases.size(); ++k) {
+        auto case_expr = std::get<0>(node->cases[k]);
+        if (case_expr->type != AstNodeType::FallthroughExpr && match_case_equal(mexpr, eval(context, case_expr))) {
+          taken = k;
+          break;
         }
       }
     }
-    return make_nop();
+
+    if (taken == -1) {
+      return make_nop_value();
+    }
+    return eval_block(context, std::get<1>(node->cases[taken]));
   }
 
   if (obj->type == AstNodeType::FuncStmt) {
-    return make_nop();
+    return make_nop_value();
   }
 
   if (obj->type == AstNodeType::MessageNode) {
     auto node = (MessageNode *)obj;
-    std::vector<AstNode *> args;
+    ArenaVector<Value> args(context->arena);
+    args.reserve(node->args.size());
 
     for (auto arg : node->args) {
       args.push_back(eval(context, arg));
     }
 
-    // HACK
-    if (node->function_name == "append") {
-      auto list_node = (ListNode*) args[0];
-      auto val = args[1];
-      list_node->list.push_back(val);
-      return make_nop();
-    }
-
-    if (node->function_name == "len") {
-      auto list_node = (ListNode *)args[0];
-      return make_number(list_node->list.size());
+    Value result;
+    if (eval_builtin(context, node->method_id, args, &result)) {
+      return result;
     }
 
     // Are we calling this on our self?
@@ -574,110 +1302,52 @@ AstNode *eval(EvalContext *context, AstNode *obj) {
     // if (node->entity_ref != nullptr) {
     //  ref = (EntityRefNode *)eval(context, node->entity_ref);
     //}
-    AstNode* eref_node = eval(context, node->entity_ref);
+    Value eref_node = eval(context, node->entity_ref);
 
-    printf("%s\n", ast_type_to_string(eref_node->type).c_str());
+    if (verbose) {
+      printf("%s\n", value_tag_to_string(eref_node.tag).c_str());
+    }
 
-    return eval_message_node(context, eref_node, node->comm_mode, node->function_name, args);
-  }
+    if (node->comm_mode == CommMode::Sync) {
+      return eval_call_site(context, node, eref_node, args.data(), args.size());
+    }
 
-  if (obj->type == AstNodeType::SymbolNode) {
-    return find_symbol(context, ((SymbolNode *)obj)->sym);
+    return eval_message_node(context, eref_node, node->comm_mode, node->method_id, std::vector<Value>(args.begin(), args.end()));
   }
 
   if (obj->type == AstNodeType::RangeNode) {
     auto range_node = safe_ncast<RangeNode*>(obj, AstNodeType::RangeNode);
-    auto start_expr = safe_ncast<NumberNode*>(eval(context, range_node->range_start), AstNodeType::NumberNode);
-    auto end_expr = safe_ncast<NumberNode *>(eval(context, range_node->range_end), AstNodeType::NumberNode);
-
-    std::vector<AstNode*> new_list;
-    for (int i = start_expr->value; i < end_expr->value; i++) {
-      new_list.push_back(make_number(i));
-    }
+    auto start_expr = eval(context, range_node->range_start);
+    auto end_expr = eval(context, range_node->range_end);
 
-    // FIXME alloc
-    CType *ctype = new CType;
-    ctype->basetype = PType::List;
-    ctype->subtype = lu8();
-    ctype->dtype = DType::Local;
-
-    return eval(context, make_list(new_list, ctype));
+    return eval_range(start_expr, end_expr);
   }
 
   if (obj->type == AstNodeType::CreateEntity) {
-    auto node = (CreateEntityNode *)obj;
-
-    auto creation_ast = cfs(context).module->entity_defs.find(node->entity_def_name);
-
-    if (creation_ast == cfs(context).module->entity_defs.end()) {
-      for (auto &[zz, _] : cfs(context).module->entity_defs) {
-        printf("%s\n", zz.c_str());
-      }
-      panic("Failed to find " + node->entity_def_name);
-    }
-
-    if (node->new_vat) {
-      return promise_new_vat(context, (EntityDef *)creation_ast->second);
-    } else {
-      Entity *ent = create_entity(context, (EntityDef *)creation_ast->second, node->new_vat);
-      return make_entity_ref(ent->address.node_id, ent->address.vat_id, ent->address.entity_id);
-    }
-  }
-
-  if (obj->type == AstNodeType::EntityRefNode) {
-    return obj;
+    return eval_create_entity(context, (CreateEntityNode *)obj);
   }
 
   if (obj->type == AstNodeType::PromiseResNode) {
     auto node = (PromiseResNode *)obj;
-
-    auto prom_sym = find_symbol(context, node->sym);
-    assert(prom_sym->type == AstNodeType::PromiseNode);
-    auto prom = (PromiseNode *)prom_sym;
-
-    assert(context->vat->promises.find(prom->promise_id) !=
-           context->vat->promises.end());
-
-    // If available, run now, else stuff the promise into the Promise stack -
-    // will be resolved + run by VM
-    if (context->vat->promises[prom->promise_id].resolved) {
-      assert(false);
-      // return eval(context, context->vat->promises[prom->promise_id].result);
-    } else {
-      context->vat->promises[prom->promise_id].callbacks.push_back(node);
-      return obj;
-    }
-  }
-
-  if (obj->type == AstNodeType::PromiseNode) {
-    return obj;
+    return eval_on_resolve(context, node, eval(context, node->promise));
   }
 
   if (obj->type == AstNodeType::ForeignFunc) {
     auto ffc = (ForeignFuncCall *)obj;
 
-    std::vector<AstNode *> args;
+    std::vector<Value> args;
     for (auto k : ffc->args) {
       args.push_back(eval(context, k));
     }
 
+    flatten_strings(context, args);
     return ffc->foreign_func(context, args);
   }
 
   if (obj->type == AstNodeType::ModUseNode) {
     auto node = (ModUseNode *)obj;
 
-    //FIXME: appending sys here breaks all user modules
-    auto find_mod = cfs(context).module->imports.find("sys►" + node->mod_name);
-
-    //for (auto &k : cfs(context).module->imports) {
-    //  printf("mod import %s\n", k.first.c_str());
-    //}
-    printf("Inside mod %s\n", node->mod_name.c_str());
-
-    assert(find_mod != cfs(context).module->imports.end());
-
-    push_stack_frame(context, cfs(context).entity, find_mod->second, "");
+    enter_module(context, node->mod_name);
 
     auto res = eval(context, node->accessor);
     pop_stack_frame(context);
@@ -689,20 +1359,21 @@ AstNode *eval(EvalContext *context, AstNode *obj) {
   assert(false);
 }
 
-std::map<std::string, AstNode *> *find_symbol_table(EvalContext *context, std::string sym) {
+Value *find_symbol_table(EvalContext *context, std::string sym) {
 for (auto x = cfs(context).scope_stack.rbegin(); x != cfs(context).scope_stack.rend(); x++) {
     auto found_it = x->table.find(sym);
-    if (found_it != x->table.end()) return &x->table;
+    if (found_it != x->table.end()) return &found_it->second;
   }
 
- if (cfs(context).entity->data.find(sym) != cfs(context).entity->data.end()) {
-   return &cfs(context).entity->data;
+  auto field = cfs(context).entity->entity_def->field_slots.find(sym);
+  if (field != cfs(context).entity->entity_def->field_slots.end()) {
+    return &cfs(context).entity->data[field->second];
   }
 
   return nullptr;
 }
 
-AstNode *find_symbol(EvalContext *context, std::string sym) {
+Value find_symbol(EvalContext *context, std::string sym) {
   // Search through lexical scopes
   for (auto x = cfs(context).scope_stack.rbegin(); x != cfs(context).scope_stack.rend(); x++) {
     auto found_it = x->table.find(sym);
@@ -710,14 +1381,15 @@ AstNode *find_symbol(EvalContext *context, std::string sym) {
   }
 
   // Search entity data
-  if (cfs(context).entity->data.find(sym) != cfs(context).entity->data.end()) {
-    return cfs(context).entity->data.find(sym)->second;
+  auto field = cfs(context).entity->entity_def->field_slots.find(sym);
+  if (field != cfs(context).entity->entity_def->field_slots.end() && value_bound(cfs(context).entity->data[field->second])) {
+    return cfs(context).entity->data[field->second];
   }
 
   // Search file scope
   if (cfs(context).module->entity_defs.find(sym) !=
       cfs(context).module->entity_defs.end()) {
-    return cfs(context).entity->module_scope->entity_defs.find(sym)->second;
+    return make_object_value(cfs(context).entity->module_scope->entity_defs.find(sym)->second);
   }
 
   dump_locals(context);
@@ -726,12 +1398,12 @@ AstNode *find_symbol(EvalContext *context, std::string sym) {
   throw PleromaException((std::string("Failed to find symbol: ") + sym).c_str());
 }
 
-AstNode *promise_new_vat(EvalContext *context, EntityDef *entity_def) {
+Value promise_new_vat(EvalContext *context, EntityDef *entity_def) {
   // FIXME when we do deeper imports
   auto split_name = split_import(entity_def->abs_mod_path);
   auto prog_name = split_name[0];
   auto ent_name = split_name[1];
-  return eval_message_node(context, monad_ref, CommMode::Async, "new-vat", {make_string(prog_name), make_string(ent_name)});
+  return eval_message_node(context, make_value(monad_ref), CommMode::Async, NEW_VAT_METHOD, {make_object_value(make_string(prog_name)), make_object_value(make_string(ent_name))});
 }
 
 Entity *create_entity(EvalContext *context, EntityDef *entity_def, bool new_vat) {
@@ -739,16 +1411,14 @@ Entity *create_entity(EvalContext *context, EntityDef *entity_def, bool new_vat)
   Vat *vat;
 
   if (new_vat) {
-    vat = new Vat;
-    vat->id = context->node->vat_id_base;
-    context->node->vat_id_base++;
+    vat = create_vat(context->node);
   } else {
     vat = context->vat;
   }
 
   e->entity_def = entity_def;
 
-  e->address.entity_id = vat->entity_id_base;
+  e->address.entity_id = vat->entities.insert(e);
   e->address.vat_id = vat->id;
   e->address.node_id = context->node->node_id;
   e->module_scope = entity_def->module;
@@ -759,21 +1429,15 @@ Entity *create_entity(EvalContext *context, EntityDef *entity_def, bool new_vat)
     dbp(log_debug, "Creating entity %s: %d %d %d", entity_def->name.c_str(), e->address.node_id, e->address.vat_id, e->address.entity_id);
   }
 
-  vat->entity_id_base++;
-
-  vat->entities[e->address.entity_id] = e;
-
-  for (auto &[k, v] : entity_def->data) {
-    // This just copies the CType
-    e->data[k] = v;
-  }
+  // Fields start unbound until create() assigns them
+  e->data.resize(entity_def->field_slots.size());
 
   for (auto &k : entity_def->inocaps) {
 
     // If far - run get_far_inocap() otherwise if local, just find the symbol and run create
     // Hack for now
     if (k.ctype->entity_name == "monad►Monad") {
-      e->data[k.var_name] = monad_ref;
+      entity_field(e, k.var_name) = make_value(monad_ref);
       //} else if (k.ctype->dtype == DType::Local) {
     } else {
       auto old_vat = context->vat;
@@ -795,7 +1459,7 @@ Entity *create_entity(EvalContext *context, EntityDef *entity_def, bool new_vat)
       // Old-method
       //Entity* io_ent = create_entity(context, (EntityDef *)entity_def->module->imports[fqn_map[lib_name]]->entity_defs[base_name], false);
       //e->data[k.var_name] = make_entity_ref(io_ent->address.node_id, io_ent->address.vat_id, io_ent->address.entity_id);
-      push_stack_frame(context, e, e->module_scope, "");
+      push_stack_frame(context, e, e->module_scope, nullptr);
       assert(monad_ref);
       //if (!monad_ref) {
       //  monad_ref = (EntityRefNode*)make_entity_ref(0, 0, 0);
@@ -804,7 +1468,8 @@ Entity *create_entity(EvalContext *context, EntityDef *entity_def, bool new_vat)
       auto helper_ref = make_entity_ref(0, 0, 0);
       helper_ref->ctype = *(k.ctype->subtype);
       //printf("Ctype %s\n", ctype_to_string(&helper_ref->ctype).c_str());
-      e->data[k.var_name] = eval_message_node(context, monad_ref, CommMode::Async, "request-far-entity", {helper_ref});
+      // Kept as an object so the monad sees the ctype
+      entity_field(e, k.var_name) = eval_message_node(context, make_value(monad_ref), CommMode::Async, REQUEST_FAR_ENTITY_METHOD, {make_object_value(helper_ref)});
       pop_stack_frame(context);
 
       // FIXME: see above
@@ -812,13 +1477,16 @@ Entity *create_entity(EvalContext *context, EntityDef *entity_def, bool new_vat)
     }
   }
 
-  auto old_vat = context->vat;
-  context->vat = vat;
-  eval_func_local(context, e, "create", {});
-  context->vat = old_vat;
+  // create() is optional
+  if (entity_def->methods.find(CREATE_METHOD) != entity_def->methods.end()) {
+    auto old_vat = context->vat;
+    context->vat = vat;
+    eval_func_local(context, e, CREATE_METHOD, {});
+    context->vat = old_vat;
+  }
 
   if (new_vat) {
-    queue.enqueue(vat);
+    start_vat(vat);
   }
 
   //printf("%s (%d, %d, %d)\n", entity_def->name.c_str(), e->address.entity_id, e->address.vat_id, e->address.node_id);
@@ -826,6 +1494,20 @@ Entity *create_entity(EvalContext *context, EntityDef *entity_def, bool new_vat)
   return e;
 }
 
+Entity *find_entity(Vat *vat, int entity_id) {
+  Entity **found = vat->entities.find(entity_id);
+  return found ? *found : nullptr;
+}
+
+Value &entity_field(Entity *e, const std::string &name) {
+  auto field = e->entity_def->field_slots.find(name);
+  if (field == e->entity_def->field_slots.end()) {
+    panic("Entity " + e->entity_def->name + " has no field " + name);
+  }
+
+  return e->data[field->second];
+}
+
 void destroy_entity(Entity* ent) {
   printf("Destroying entity\n");
 }
@@ -858,9 +1540,9 @@ void print_value_node(ValueNode *value_node) {
 
 void print_msg(Msg *m) {
   if (m->response) {
-    printf("MsgResponse => %s\n", m->function_name.c_str());
+    printf("MsgResponse => %s\n", method_name(m->method_id).c_str());
   } else {
-    printf("Msg => %s\n", m->function_name.c_str());
+    printf("Msg => %s\n", method_name(m->method_id).c_str());
   }
 
   printf("\tTarget: Node: %d, Vat: %d, Entity: %d\n", m->node_id, m->vat_id,
@@ -869,9 +1551,8 @@ void print_msg(Msg *m) {
          m->src_vat_id, m->src_entity_id);
   printf("\tOther: Promise: %d\n", m->promise_id);
   printf("\tPayload (%zu): ", m->values.size());
-  for (auto k : m->values) {
-    printf("val %d\n", k->value_type);
-    //print_value_node(k);
+  for (auto &k : m->values) {
+    printf("%s ", stringify_value(k).c_str());
   }
   printf("\n\n");
 }
@@ -880,43 +1561,59 @@ void start_context(EvalContext *context, PleromaNode *node, Vat *vat, HylicModul
   context->node = node;
   context->vat = vat;
 
-  push_stack_frame(context, entity, module, "");
+  context->arena = vat->allocator;
+  context->stack = ArenaVector<StackFrame>(context->arena);
+  context->vm_stack = ArenaVector<Value>(context->arena);
+  context->vm_iters = ArenaVector<ForIter>(context->arena);
+  context->spare_locals = ArenaVector<ArenaVector<Value>>(context->arena);
+
+  push_stack_frame(context, entity, module, nullptr);
 
   cfs(context).module = module;
   cfs(context).entity = entity;
 
   if (entity) {
-    css(context).table = entity->module_scope->entity_defs;
-    if (entity) {
-      css(context).table["self"] = make_entity_ref(entity->address.node_id, entity->address.vat_id, entity->address.entity_id);
-    } else {
-      // FIXME we should not have this
-      css(context).table["self"] = make_entity_ref(-1, -1, -1);
+    for (auto &[k, v] : entity->module_scope->entity_defs) {
+      css(context).table[k] = make_object_value(v);
     }
+    css(context).table["self"] = make_entity_ref_value(entity->address.node_id, entity->address.vat_id, entity->address.entity_id);
   }
 }
 
+Scope make_scope(EvalContext *context) {
+  return Scope{ArenaMap<std::string, Value>(ArenaAllocator<std::pair<const std::string, Value>>(context->arena))};
+}
+
 void push_scope(EvalContext *context) {
-  cfs(context).scope_stack.push_back(Scope());
+  cfs(context).scope_stack.push_back(make_scope(context));
 }
 
 void pop_scope(EvalContext *context) {
   cfs(context).scope_stack.pop_back();
 }
 
-void push_stack_frame(EvalContext *context, Entity* e, HylicModule* module, std::string func_name) {
+void push_stack_frame(EvalContext *context, Entity* e, HylicModule* module, FuncStmt *func) {
   context->stack.push_back(StackFrame());
-  context->stack.back().entity = e;
-  context->stack.back().module = module;
-
-  if (module && e) {
-    context->stack.back().mef_name = module->abs_module_path + "::" + e->entity_def->name + "::" + func_name;
+  auto &frame = context->stack.back();
+  frame.locals = ArenaVector<Value>(context->arena);
+  frame.scope_stack = ArenaVector<Scope>(context->arena);
+  frame.frame_objects = ArenaVector<AstNode *>(context->arena);
+  frame.entity = e;
+  frame.module = module;
+  frame.func = func;
+
+  if (!context->spare_locals.empty()) {
+    frame.locals.swap(context->spare_locals.back());
+    context->spare_locals.pop_back();
+    frame.locals.clear();
   }
-
-  push_scope(context);
 }
 
 void pop_stack_frame(EvalContext *context) {
+  for (auto obj : cfs(context).frame_objects) {
+    destroy_ast_obj(obj);
+  }
+  context->spare_locals.push_back(std::move(cfs(context).locals));
   context->stack.pop_back();
 }
 
@@ -927,14 +1624,24 @@ StackFrame& cfs(EvalContext *context) {
 
 // Current stack scope
 Scope &css(EvalContext *context) {
-  return context->stack.back().scope_stack.back();
+  auto &scope_stack = context->stack.back().scope_stack;
+  if (scope_stack.empty()) {
+    scope_stack.push_back(make_scope(context));
+  }
+  return scope_stack.back();
 }
 
 void dump_locals(EvalContext* context) {
   printf("\nLocals:\n");
+  for (int k = 0; k < cfs(context).locals.size(); ++k) {
+    auto &v = cfs(context).locals[k];
+    if (value_bound(v)) {
+      printf("\t[%d] (%s) : %s\n", k, value_tag_to_string(v.tag).c_str(), stringify_value(v).c_str());
+    }
+  }
   for (auto x = cfs(context).scope_stack.rbegin(); x != cfs(context).scope_stack.rend(); x++) {
     for (auto &[k, v] : x->table) {
-      printf("\t%s (%s) : %s\n", k.c_str(), ast_type_to_string(v->type).c_str(), stringify_value_node(v).c_str());
+      printf("\t%s (%s) : %s\n", k.c_str(), value_tag_to_string(v.tag).c_str(), stringify_value(v).c_str());
     }
   }
   printf("\n");
@@ -943,7 +1650,16 @@ void dump_locals(EvalContext* context) {
 void dump_local_stack(EvalContext* context) {
   printf("\nStack (local):\n");
   for (auto x = context->stack.rbegin(); x != context->stack.rend(); x++) {
-    printf("\tFrame: %s\n", x->mef_name.c_str());
+    printf("\tFrame: %s\n", frame_name(&*x).c_str());
   }
   printf("\n");
 }
+
+std::string frame_name(StackFrame *frame) {
+  if (!frame->module || !frame->entity) {
+    return "";
+  }
+
+  std::string func_name = frame->func ? frame->func->name : "";
+  return frame->module->abs_module_path + "::" + frame->entity->entity_def->name + "::" + func_name;
+}
@@ -4,6 +4,10 @@
 #include "common.h"
 #include "hylic_ast.h"
 #include "hylic_parse.h"
+#include "mailbox.h"
+#include "slot_map.h"
+#include <atomic>
+#include <deque>
 #include <mutex>
 #include <queue>
 #include <string>
@@ -19,7 +23,8 @@ struct Entity {
   EntityDef *entity_def;
   EntityAddress address;
 
-  std::map<std::string, AstNode *> data;
+  // Laid out by EntityDef::field_slots
+  std::vector<Value> data;
   HylicModule* module_scope;
   std::map<std::string, AstNode *> _kdata;
 
@@ -39,9 +44,9 @@ struct Msg {
   int src_vat_id = 0;
   int src_node_id = 0;
 
-  std::string function_name;
+  MethodId method_id = NO_METHOD;
 
-  std::vector<ValueNode *> values;
+  std::vector<Value> values;
 };
 
 struct DependPromFunc {
@@ -50,15 +55,20 @@ struct DependPromFunc {
 
   int target_depends_on = -1;
 
-  std::string function_name;
-  std::vector<AstNode *> args;
+  MethodId method_id;
+  // Empty until the promise it waits on resolves
+  std::vector<Value> args;
   // Promise ID -> result idx
   std::map<int, int> depends_on;
 };
 
+// A response carrying no values rejects the promise it answers.  Callbacks
+// and dependents are freed once the promise settles either way, the entry
+// itself is reclaimed by the GC once no entity holds it.
 struct PromiseResult {
   bool resolved = false;
-  std::vector<ValueNode *> results;
+  bool rejected = false;
+  std::vector<Value> results;
   std::vector<PromiseResNode*> callbacks;
 
   std::vector<DependPromFunc*> dependents;
@@ -66,33 +76,76 @@ struct PromiseResult {
   // Return info
   bool return_msg = false;
   Msg msg;
+
+  // Pending timeout, see promise-timeout
+  bool has_timer = false;
+  u64 timer_id = 0;
+};
+
+// Up to 1M live promises and 4M entities per vat, the remaining bits of an
+// id are the generation
+const int PROMISE_INDEX_BITS = 20;
+const int ENTITY_INDEX_BITS = 22;
+
+// A pure function and the arguments it was called with, each as its payload
+// and tag.  Only numbers and booleans make a key.
+struct MemoKey {
+  FuncStmt *func;
+  std::vector<s64> args;
+
+  bool operator<(const MemoKey &other) const {
+    return func < other.func || (func == other.func && args < other.args);
+  }
+};
+
+// Results of pure function calls, see memo_size
+struct MemoCache {
+  std::map<MemoKey, Value> results;
+  // Insertion order, the oldest result goes once the cache is full
+  std::deque<MemoKey> order;
+
+  u64 hits = 0;
+  u64 misses = 0;
+};
+
+enum class VatState {
+  Idle,
+  Scheduled,
+  Running
 };
 
 struct Vat {
   int id = 0;
   int run_n = 0;
-  int entity_id_base = 0;
 
-  int promise_id_base = 0;
+  // Pushed to from any thread, popped by the burner running the vat
+  Mailbox<Msg> messages;
 
-  std::mutex message_mtx;
-  std::queue<Msg> messages;
+  // Only touched by the burner running the vat
   std::queue<Msg> out_messages;
 
-  std::map<int, PromiseResult> promises;
+  // Promise ids are handed out by the table, see SlotMap
+  SlotMap<PromiseResult, PROMISE_INDEX_BITS> promises;
 
-  std::map<int, Entity *> entities;
+  // Entity ids are handed out by the table, the first entity is always 0
+  SlotMap<Entity *, ENTITY_INDEX_BITS> entities;
 
-  VatAllocator *allocator;
+  // Reset after each message, nullptr for scratch vats that use the heap
+  VatAllocator *allocator = nullptr;
 
   std::vector<Entity*> all_entities;
   std::vector<AstNode*> all_objects;
 
   int cycle_since_gc = 0;
+
+  MemoCache memo;
+
+  // Idle vats are parked off the run queues until a message wakes them
+  std::atomic<VatState> state{VatState::Idle};
 };
 
 struct Scope {
-  std::map<std::string, AstNode *> table;
+  ArenaMap<std::string, Value> table;
 };
 
 struct PleromaNode {
@@ -100,7 +153,7 @@ struct PleromaNode {
 
   u32 node_id = 0;
 
-  int vat_id_base = 0;
+  std::atomic<int> vat_id_base{0};
 
   std::vector<std::string> resources;
 
@@ -110,40 +163,129 @@ struct PleromaNode {
 struct StackFrame {
   HylicModule *module;
   Entity *entity;
-  std::vector<Scope> scope_stack;
+  // Resolved symbols, by slot
+  ArenaVector<Value> locals;
+  // Names the resolver left to runtime, empty until css() needs one
+  ArenaVector<Scope> scope_stack;
+  // Made by OperatorExpr::frame_local sites, destroyed when the frame is
+  // popped instead of waiting for the GC
+  ArenaVector<AstNode *> frame_objects;
+
+  // nullptr outside of a function body
+  FuncStmt *func = nullptr;
+};
 
-  std::string mef_name;
+// Where a ForStmt is in its generator.  Ranges count without building a list,
+// lists are walked in place.
+struct ForIter {
+  ListNode *list = nullptr;
+  s64 next = 0;
+  s64 end = 0;
 };
 
+// Frames, scopes and operand stacks are carved from the vat's allocator, a
+// context must be gone before that is reset
 struct EvalContext {
   PleromaNode *node;
   Vat *vat;
-  std::vector<StackFrame> stack;
+  VatAllocator *arena = nullptr;
+  ArenaVector<StackFrame> stack;
+
+  // Nodes evaluated, charged against the vat's slice budget
+  u64 reductions = 0;
+
+  // Operands and loop iterators of the bytecode VM, shared by nested calls
+  ArenaVector<Value> vm_stack;
+  ArenaVector<ForIter> vm_iters;
+
+  // Locals of popped frames, reused so calls don't allocate
+  ArenaVector<ArenaVector<Value>> spare_locals;
 };
 
-AstNode *eval(EvalContext *context, AstNode *obj);
-std::map<std::string, AstNode *> *find_symbol_table(EvalContext *context, std::string sym);
-AstNode *find_symbol(EvalContext *context, std::string sym);
+enum class Engine { Tree, Bytecode };
+
+// Runs function bodies and promise callbacks
+extern Engine engine;
+// Pure function results kept per vat, 0 turns memoization off
+extern int memo_size;
+
+Value eval(EvalContext *context, AstNode *obj);
+Value eval_block(EvalContext *context, const std::vector<AstNode *> &block);
+
+// Shared by both engines
+bool is_builtin(MethodId method_id);
+bool eval_builtin(EvalContext *context, MethodId method_id, ArenaVector<Value> &args, Value *result);
+Value eval_operator(EvalContext *context, OperatorExpr::Op op, const Value &n1, const Value &n2);
+Value eval_comparison(BooleanExpr::Op op, const Value &term1, const Value &term2);
+// No checks, for operands typesolve() found to be numbers or strings
+Value eval_number_operator(OperatorExpr::Op op, s64 left, s64 right);
+Value eval_concat(EvalContext *context, const Value &left, const Value &right, bool frame_local);
+Value eval_number_comparison(BooleanExpr::Op op, s64 left, s64 right);
+Value eval_string_equals(const Value &left, const Value &right);
+Value eval_index(const Value &list, const Value &accessor);
+Value eval_range(const Value &range_start, const Value &range_end);
+ForIter make_range_iter(const Value &range_start, const Value &range_end);
+ForIter make_list_iter(const Value &list);
+// False once the generator is exhausted
+bool for_iter_next(ForIter *iter, Value *value);
+void store_index(EvalContext *context, const Value &list, const Value &accessor, const Value &value);
+bool match_case_equal(const Value &mexpr, const Value &mca_eval);
+// Arm of a tabled match that mexpr selects, the default if none does, -1 if
+// there's no default either
+int match_table_case(MatchNode *node, const Value &mexpr);
+void assign_symbol(EvalContext *context, SymbolNode *sym, const Value &value);
+Value eval_create_entity(EvalContext *context, CreateEntityNode *node);
+Value eval_on_resolve(EvalContext *context, PromiseResNode *node, const Value &prom_sym);
+void enter_module(EvalContext *context, const std::string &mod_name);
+// Lists hold nodes, this boxes immediates into ones the vat's GC owns
+AstNode *box_value(EvalContext *context, const Value &value);
+// Writes unbox or box the list's storage as needed
+void list_push(EvalContext *context, ListNode *list, const Value &value);
+void list_set(EvalContext *context, ListNode *list, size_t index, const Value &value);
+void box_list(EvalContext *context, ListNode *list);
+AstNode *list_from_values(EvalContext *context, const ArenaVector<Value> &values, CType *ctype);
+bool is_string(const Value &value);
+// Foreign functions only take StringNodes, this flattens any ropes
+void flatten_strings(EvalContext *context, std::vector<Value> &args);
+Value *find_symbol_table(EvalContext *context, std::string sym);
+Value find_symbol(EvalContext *context, std::string sym);
 Entity *create_entity(EvalContext *context, EntityDef *entity_def, bool new_vat);
+// Named access to a data field or inocap, for builtins
+Value &entity_field(Entity *e, const std::string &name);
+// nullptr if the id is stale or was never handed out
+Entity *find_entity(Vat *vat, int entity_id);
 void destroy_entity(Entity* e);
-AstNode *eval_func_local(EvalContext *context, Entity *entity, std::string function_name, std::vector<AstNode *> args);
-AstNode *eval_promise_local(EvalContext *context, Entity *entity, PromiseResult *resolve_node, int promise_id);
-AstNode *promise_new_vat(EvalContext *context, EntityDef *entity_def);
+Value eval_func_local(EvalContext *context, Entity *entity, MethodId method_id, std::vector<Value> args);
+FuncStmt *find_method(EntityDef *entity_def, MethodId method_id);
+Value call_method(EvalContext *context, Entity *entity, FuncStmt *func, const Value *args, int argc);
+// Sync call through the site's inline cache
+Value eval_call_site(EvalContext *context, MessageNode *site, const Value &target, const Value *args, int argc);
+Value eval_promise_local(EvalContext *context, Entity *entity, PromiseResult *resolve_node, int promise_id);
+void settle_promise(Vat *vat, PromiseResult *promise);
+bool reject_promise(Vat *vat, int promise_id);
+Value promise_new_vat(EvalContext *context, EntityDef *entity_def);
 void print_value_node(ValueNode * value_node);
 void print_msg(Msg * m);
+// Values leaving the vat are copied, the receiver may run on another burner
+// and the objects they point to belong to the sender's GC.  Unboxed list
+// elements stay shared.
+Value copy_msg_value(const Value &value);
+// Hands the objects of a received message to the receiving vat's GC
+void adopt_msg_values(Vat *vat, const std::vector<Value> &values);
 
 void start_context(EvalContext * context, PleromaNode * node, Vat * vat,
                    HylicModule * module, Entity * entity);
-void push_stack_frame(EvalContext * context, Entity * e, HylicModule * module, std::string func_name);
+void push_stack_frame(EvalContext * context, Entity * e, HylicModule * module, FuncStmt * func);
 void pop_stack_frame(EvalContext * context);
 
 void pop_scope(EvalContext * context);
 void push_scope(EvalContext * context);
 
-AstNode *eval_message_node(EvalContext * context, AstNode * entity_ref, CommMode comm_mode, std::string function_name, std::vector<AstNode *> args);
+Value eval_message_node(EvalContext * context, const Value &entity_ref, CommMode comm_mode, MethodId method_id, std::vector<Value> args);
 
 StackFrame &cfs(EvalContext * context);
 Scope &css(EvalContext * context);
 
 void dump_locals(EvalContext *context);
 void dump_local_stack(EvalContext *context);
+std::string frame_name(StackFrame *frame);
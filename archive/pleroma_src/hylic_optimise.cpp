@@ -0,0 +1,615 @@
+#include "hylic_optimise.h"
+#include "hylic_eval.h"
+#include "general_util.h"
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+bool dump_node_counts = false;
+
+// How deep pure calls are followed into each other while folding
+const int MAX_FOLD_DEPTH = 16;
+
+struct OptimiseContext {
+  EntityDef *entity_def;
+};
+
+// Literals bound to the parameters of a pure function being folded
+typedef std::map<std::string, AstNode *> FoldBindings;
+
+bool is_constant(AstNode *node) {
+  return in(node->type, {AstNodeType::NumberNode, AstNodeType::BooleanNode, AstNodeType::StringNode});
+}
+
+AstNode *fold_expr(OptimiseContext *context, AstNode *node, FoldBindings *bindings, int depth);
+
+// A sync call to one of the entity's own pure functions whose body is just a
+// return folds to that return, given its arguments fold
+AstNode *fold_pure_call(OptimiseContext *context, MessageNode *node, FoldBindings *bindings, int depth) {
+  if (depth >= MAX_FOLD_DEPTH || node->comm_mode != CommMode::Sync || node->entity_ref->type != AstNodeType::SelfNode ||
+      is_builtin(node->method_id)) {
+    return nullptr;
+  }
+
+  auto func_it = context->entity_def->functions.find(node->function_name);
+  if (func_it == context->entity_def->functions.end()) {
+    return nullptr;
+  }
+
+  FuncStmt *func = func_it->second;
+  if (!func->pure || func->args.size() != node->args.size()) {
+    return nullptr;
+  }
+
+  ReturnNode *ret = nullptr;
+  for (auto stmt : func->body) {
+    if (stmt->type == AstNodeType::CommentNode) {
+      continue;
+    }
+    if (ret || stmt->type != AstNodeType::ReturnNode) {
+      return nullptr;
+    }
+    ret = (ReturnNode *)stmt;
+  }
+  if (!ret) {
+    return nullptr;
+  }
+
+  FoldBindings params;
+  for (int i = 0; i < node->args.size(); ++i) {
+    auto arg = fold_expr(context, node->args[i], bindings, depth);
+    if (!arg) {
+      return nullptr;
+    }
+    params[func->args[i]] = arg;
+  }
+
+  return fold_expr(context, ret->expr, &params, depth + 1);
+}
+
+// The literal node evaluates to, or nullptr if it isn't known until runtime.
+// Mirrors eval_operator() and eval_comparison().
+AstNode *fold_expr(OptimiseContext *context, AstNode *node, FoldBindings *bindings, int depth) {
+  if (is_constant(node)) {
+    return node;
+  }
+
+  switch (node->type) {
+  case AstNodeType::SymbolNode: {
+    auto found = bindings->find(((SymbolNode *)node)->sym);
+    return found != bindings->end() ? found->second : nullptr;
+  } break;
+
+  case AstNodeType::OperatorExpr: {
+    auto op_expr = (OperatorExpr *)node;
+    auto n1 = fold_expr(context, op_expr->term1, bindings, depth);
+    auto n2 = n1 ? fold_expr(context, op_expr->term2, bindings, depth) : nullptr;
+    if (!n2 || n1->type != n2->type) {
+      return nullptr;
+    }
+
+    // Division by zero is left to fail at runtime
+    if (n1->type == AstNodeType::NumberNode && !(op_expr->op == OperatorExpr::Divide && ((NumberNode *)n1)->value == 0)) {
+      return make_number(eval_number_operator(op_expr->op, ((NumberNode *)n2)->value, ((NumberNode *)n1)->value).number);
+    } else if (n1->type == AstNodeType::StringNode && op_expr->op == OperatorExpr::Plus) {
+      return make_string(((StringNode *)n2)->value + ((StringNode *)n1)->value);
+    }
+  } break;
+
+  case AstNodeType::BooleanExpr: {
+    auto bool_expr = (BooleanExpr *)node;
+    auto term1 = fold_expr(context, bool_expr->term1, bindings, depth);
+    auto term2 = term1 ? fold_expr(context, bool_expr->term2, bindings, depth) : nullptr;
+    if (!term2 || term1->type != term2->type) {
+      return nullptr;
+    }
+
+    if (term1->type == AstNodeType::NumberNode) {
+      return make_boolean(value_boolean(eval_comparison(bool_expr->op, make_value(term1), make_value(term2))));
+    } else if (term1->type == AstNodeType::StringNode && bool_expr->op == BooleanExpr::Equals) {
+      return make_boolean(((StringNode *)term1)->value == ((StringNode *)term2)->value);
+    }
+  } break;
+
+  case AstNodeType::MessageNode: {
+    return fold_pure_call(context, (MessageNode *)node, bindings, depth);
+  } break;
+
+  default:
+    break;
+  }
+
+  return nullptr;
+}
+
+bool match_constants_equal(AstNode *a, AstNode *b) {
+  switch (a->type) {
+  case AstNodeType::NumberNode:
+    return ((NumberNode *)a)->value == ((NumberNode *)b)->value;
+  case AstNodeType::BooleanNode:
+    return ((BooleanNode *)a)->value == ((BooleanNode *)b)->value;
+  case AstNodeType::StringNode:
+    return ((StringNode *)a)->value == ((StringNode *)b)->value;
+  default:
+    return false;
+  }
+}
+
+// Statements that do nothing when evaluated
+bool is_noop(AstNode *node) {
+  return in(node->type, {AstNodeType::CommentNode, AstNodeType::Nop}) || is_constant(node);
+}
+
+AstNode *optimise_node(OptimiseContext *context, AstNode *node);
+
+void optimise_block(OptimiseContext *context, std::vector<AstNode *> &block) {
+  std::vector<AstNode *> optimised;
+  for (auto stmt : block) {
+    stmt = optimise_node(context, stmt);
+    if (!is_noop(stmt)) {
+      optimised.push_back(stmt);
+    }
+  }
+  block = optimised;
+}
+
+// Optimises node's children in place, returns what should replace node
+AstNode *optimise_node(OptimiseContext *context, AstNode *node) {
+  switch (node->type) {
+
+  case AstNodeType::AssignmentStmt: {
+    auto ass_stmt = (AssignmentStmt *)node;
+    ass_stmt->value = optimise_node(context, ass_stmt->value);
+    if (ass_stmt->sym->type == AstNodeType::IndexNode) {
+      ass_stmt->sym = optimise_node(context, ass_stmt->sym);
+    }
+  } break;
+
+  case AstNodeType::OperatorExpr: {
+    auto op_expr = (OperatorExpr *)node;
+    op_expr->term1 = optimise_node(context, op_expr->term1);
+    op_expr->term2 = optimise_node(context, op_expr->term2);
+  } break;
+
+  case AstNodeType::BooleanExpr: {
+    auto bool_expr = (BooleanExpr *)node;
+    bool_expr->term1 = optimise_node(context, bool_expr->term1);
+    bool_expr->term2 = optimise_node(context, bool_expr->term2);
+  } break;
+
+  case AstNodeType::IndexNode: {
+    auto ind_node = (IndexNode *)node;
+    ind_node->list = optimise_node(context, ind_node->list);
+    ind_node->accessor = optimise_node(context, ind_node->accessor);
+  } break;
+
+  case AstNodeType::RangeNode: {
+    auto range_node = (RangeNode *)node;
+    range_node->range_start = optimise_node(context, range_node->range_start);
+    range_node->range_end = optimise_node(context, range_node->range_end);
+  } break;
+
+  case AstNodeType::ReturnNode: {
+    auto ret_node = (ReturnNode *)node;
+    ret_node->expr = optimise_node(context, ret_node->expr);
+  } break;
+
+  case AstNodeType::ListNode: {
+    auto list_node = (ListNode *)node;
+    for (int i = 0; i < list_node->list.size(); ++i) {
+      auto elem = optimise_node(context, list_node->list[i]);
+      if (elem != list_node->list[i]) {
+        list_node->list.set(i, elem);
+      }
+    }
+  } break;
+
+  case AstNodeType::MessageNode: {
+    for (auto &k : ((MessageNode *)node)->args) {
+      k = optimise_node(context, k);
+    }
+  } break;
+
+  case AstNodeType::ForeignFunc: {
+    for (auto &k : ((ForeignFuncCall *)node)->args) {
+      k = optimise_node(context, k);
+    }
+  } break;
+
+  case AstNodeType::WhileStmt: {
+    auto while_node = (WhileStmt *)node;
+    while_node->generator = optimise_node(context, while_node->generator);
+    if (while_node->generator->type == AstNodeType::BooleanNode && !((BooleanNode *)while_node->generator)->value) {
+      return make_nop();
+    }
+    optimise_block(context, while_node->body);
+  } break;
+
+  case AstNodeType::ForStmt: {
+    auto for_node = (ForStmt *)node;
+    for_node->generator = optimise_node(context, for_node->generator);
+    optimise_block(context, for_node->body);
+  } break;
+
+  case AstNodeType::MatchNode: {
+    auto match_node = (MatchNode *)node;
+    match_node->match_expr = optimise_node(context, match_node->match_expr);
+    bool constant = is_constant(match_node->match_expr);
+
+    // The first arm equal to a literal wins, leaving nothing after it and no
+    // default to run.  Only the first fallthrough can ever be the default.
+    std::vector<std::tuple<AstNode *, std::vector<AstNode *>>> cases;
+    bool has_default = false;
+    bool matched = false;
+    for (auto &match_case : match_node->cases) {
+      auto case_expr = optimise_node(context, std::get<0>(match_case));
+      optimise_block(context, std::get<1>(match_case));
+
+      if (case_expr->type == AstNodeType::FallthroughExpr) {
+        if (!has_default) {
+          cases.push_back({case_expr, std::get<1>(match_case)});
+          has_default = true;
+        }
+        continue;
+      }
+
+      if (matched) {
+        continue;
+      }
+
+      if (constant && is_constant(case_expr) && case_expr->type == match_node->match_expr->type) {
+        if (match_constants_equal(match_node->match_expr, case_expr)) {
+          cases.push_back({case_expr, std::get<1>(match_case)});
+          matched = true;
+        }
+        continue;
+      }
+
+      cases.push_back({case_expr, std::get<1>(match_case)});
+    }
+
+    if (matched) {
+      cases.erase(std::remove_if(cases.begin(), cases.end(),
+                                 [](auto &match_case) { return std::get<0>(match_case)->type == AstNodeType::FallthroughExpr; }),
+                  cases.end());
+    }
+    match_node->cases = cases;
+    build_match_table(match_node);
+
+    if (cases.empty() && constant) {
+      return make_nop();
+    }
+  } break;
+
+  case AstNodeType::PromiseResNode: {
+    optimise_block(context, ((PromiseResNode *)node)->body);
+  } break;
+
+  default:
+    break;
+  }
+
+  if (is_constant(node)) {
+    return node;
+  }
+
+  FoldBindings bindings;
+  auto folded = fold_expr(context, node, &bindings, 0);
+  return folded ? folded : node;
+}
+
+// Every node directly under node, blocks included
+std::vector<AstNode *> node_children(AstNode *node) {
+  std::vector<AstNode *> children;
+
+  switch (node->type) {
+  case AstNodeType::AssignmentStmt:
+    children = {((AssignmentStmt *)node)->sym, ((AssignmentStmt *)node)->value};
+    break;
+  case AstNodeType::OperatorExpr:
+    children = {((OperatorExpr *)node)->term1, ((OperatorExpr *)node)->term2};
+    break;
+  case AstNodeType::BooleanExpr:
+    children = {((BooleanExpr *)node)->term1, ((BooleanExpr *)node)->term2};
+    break;
+  case AstNodeType::IndexNode:
+    children = {((IndexNode *)node)->list, ((IndexNode *)node)->accessor};
+    break;
+  case AstNodeType::RangeNode:
+    children = {((RangeNode *)node)->range_start, ((RangeNode *)node)->range_end};
+    break;
+  case AstNodeType::ReturnNode:
+    children = {((ReturnNode *)node)->expr};
+    break;
+  case AstNodeType::ListNode:
+    children.assign(((ListNode *)node)->list.begin(), ((ListNode *)node)->list.end());
+    break;
+  case AstNodeType::MessageNode:
+    children = ((MessageNode *)node)->args;
+    children.push_back(((MessageNode *)node)->entity_ref);
+    break;
+  case AstNodeType::ForeignFunc:
+    children = ((ForeignFuncCall *)node)->args;
+    break;
+  case AstNodeType::WhileStmt:
+    children = ((WhileStmt *)node)->body;
+    children.push_back(((WhileStmt *)node)->generator);
+    break;
+  case AstNodeType::ForStmt:
+    children = ((ForStmt *)node)->body;
+    children.push_back(((ForStmt *)node)->generator);
+    break;
+  case AstNodeType::MatchNode:
+    children.push_back(((MatchNode *)node)->match_expr);
+    for (auto &match_case : ((MatchNode *)node)->cases) {
+      children.push_back(std::get<0>(match_case));
+      children.insert(children.end(), std::get<1>(match_case).begin(), std::get<1>(match_case).end());
+    }
+    break;
+  case AstNodeType::PromiseResNode:
+    children = ((PromiseResNode *)node)->body;
+    break;
+  case AstNodeType::ModUseNode:
+    children = {((ModUseNode *)node)->accessor};
+    break;
+  default:
+    break;
+  }
+
+  return children;
+}
+
+// Nodes reachable from node, for dump_node_counts
+int count_nodes(AstNode *node) {
+  int count = 1;
+  for (auto k : node_children(node)) {
+    count += count_nodes(k);
+  }
+  return count;
+}
+
+// Builtins that only touch their arguments
+bool is_parallel_builtin(const std::string &name) {
+  return in(name, {"append", "len", "list-sum", "list-min", "list-max", "list-find"});
+}
+
+// Whether node only calls the entity's own parallel_safe functions and
+// builtins that don't reach outside their arguments
+bool parallel_safe(OptimiseContext *context, AstNode *node) {
+  switch (node->type) {
+  case AstNodeType::MessageNode: {
+    auto msg_node = (MessageNode *)node;
+    if (msg_node->comm_mode != CommMode::Sync || msg_node->entity_ref->type != AstNodeType::SelfNode) {
+      return false;
+    }
+
+    if (is_builtin(msg_node->method_id)) {
+      if (!is_parallel_builtin(msg_node->function_name)) {
+        return false;
+      }
+    } else {
+      auto func_it = context->entity_def->functions.find(msg_node->function_name);
+      if (func_it == context->entity_def->functions.end() || !func_it->second->parallel_safe) {
+        return false;
+      }
+    }
+  } break;
+
+  case AstNodeType::ForeignFunc:
+  case AstNodeType::CreateEntity:
+  case AstNodeType::PromiseResNode:
+  case AstNodeType::ModUseNode:
+    return false;
+
+  default:
+    break;
+  }
+
+  for (auto k : node_children(node)) {
+    if (!parallel_safe(context, k)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Starts from every pure function and clears those that call anything
+// unsafe until nothing changes, so pure functions calling each other
+// recursively stay safe
+void mark_parallel_safe(OptimiseContext *context) {
+  for (auto &[_, func] : context->entity_def->functions) {
+    func->parallel_safe = func->pure;
+  }
+
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (auto &[_, func] : context->entity_def->functions) {
+      if (!func->parallel_safe) {
+        continue;
+      }
+      for (auto k : func->body) {
+        if (!parallel_safe(context, k)) {
+          func->parallel_safe = false;
+          changed = true;
+          break;
+        }
+      }
+    }
+  }
+}
+
+// String concatenations of one function and where their results go
+struct EscapeContext {
+  EntityDef *entity_def;
+  std::vector<OperatorExpr *> sites;
+  std::set<OperatorExpr *> escaping_sites;
+  // Locals whose value may outlive the frame
+  std::set<std::string> escaping;
+  // Each assignment to a local, flow is tracked by name only
+  std::vector<std::tuple<std::string, AstNode *>> bindings;
+};
+
+bool is_concat(AstNode *node) {
+  return node->type == AstNodeType::OperatorExpr && ((OperatorExpr *)node)->operands == OperandKind::String;
+}
+
+// The value of node may outlive the frame, and so may anything it's made of:
+// a rope holds on to both sides
+void value_escapes(EscapeContext *context, AstNode *node) {
+  switch (node->type) {
+  case AstNodeType::SymbolNode:
+    context->escaping.insert(((SymbolNode *)node)->sym);
+    break;
+  case AstNodeType::OperatorExpr:
+    if (is_concat(node)) {
+      context->escaping_sites.insert((OperatorExpr *)node);
+      value_escapes(context, ((OperatorExpr *)node)->term1);
+      value_escapes(context, ((OperatorExpr *)node)->term2);
+    }
+    break;
+  case AstNodeType::AssignmentStmt:
+    value_escapes(context, ((AssignmentStmt *)node)->value);
+    break;
+  default:
+    break;
+  }
+}
+
+// For code that runs in another frame
+void all_escape(EscapeContext *context, AstNode *node) {
+  value_escapes(context, node);
+  for (auto k : node_children(node)) {
+    all_escape(context, k);
+  }
+}
+
+// A value escapes by being returned, stored outside the frame's locals, or
+// handed to anything but a builtin that only reads it
+void find_escapes(EscapeContext *context, AstNode *node) {
+  switch (node->type) {
+  case AstNodeType::OperatorExpr:
+    if (is_concat(node)) {
+      context->sites.push_back((OperatorExpr *)node);
+    }
+    break;
+
+  case AstNodeType::ReturnNode:
+    value_escapes(context, ((ReturnNode *)node)->expr);
+    break;
+
+  case AstNodeType::AssignmentStmt: {
+    auto ass_stmt = (AssignmentStmt *)node;
+    auto sym = ass_stmt->sym;
+    if (sym->type == AstNodeType::SymbolNode &&
+        context->entity_def->field_slots.find(((SymbolNode *)sym)->sym) == context->entity_def->field_slots.end()) {
+      context->bindings.push_back({((SymbolNode *)sym)->sym, ass_stmt->value});
+    } else {
+      value_escapes(context, ass_stmt->value);
+    }
+  } break;
+
+  case AstNodeType::MessageNode: {
+    auto msg_node = (MessageNode *)node;
+    bool reads_only = is_builtin(msg_node->method_id) && is_parallel_builtin(msg_node->function_name) &&
+                      msg_node->function_name != "append";
+    if (!reads_only) {
+      for (auto arg : msg_node->args) {
+        value_escapes(context, arg);
+      }
+    }
+  } break;
+
+  case AstNodeType::ForeignFunc:
+    for (auto arg : ((ForeignFuncCall *)node)->args) {
+      value_escapes(context, arg);
+    }
+    break;
+
+  case AstNodeType::ListNode:
+    for (auto elem : ((ListNode *)node)->list) {
+      value_escapes(context, elem);
+    }
+    break;
+
+  case AstNodeType::PromiseResNode:
+  case AstNodeType::ModUseNode:
+    all_escape(context, node);
+    return;
+
+  default:
+    break;
+  }
+
+  for (auto k : node_children(node)) {
+    find_escapes(context, k);
+  }
+}
+
+// Sets OperatorExpr::frame_local on the concatenations in func whose results
+// can't escape it
+void mark_frame_local(EntityDef *entity_def, FuncStmt *func) {
+  EscapeContext context;
+  context.entity_def = entity_def;
+
+  for (auto k : func->body) {
+    find_escapes(&context, k);
+  }
+
+  // Anything assigned to an escaping local escapes as well
+  size_t n_escaping;
+  do {
+    n_escaping = context.escaping.size() + context.escaping_sites.size();
+    for (auto &[sym, value] : context.bindings) {
+      if (context.escaping.find(sym) != context.escaping.end()) {
+        value_escapes(&context, value);
+      }
+    }
+  } while (n_escaping != context.escaping.size() + context.escaping_sites.size());
+
+  for (auto site : context.sites) {
+    site->frame_local = context.escaping_sites.find(site) == context.escaping_sites.end();
+  }
+}
+
+int count_entity_nodes(EntityDef *entity_def) {
+  int count = 0;
+  for (auto &[_, func] : entity_def->functions) {
+    count++;
+    for (auto k : func->body) {
+      count += count_nodes(k);
+    }
+  }
+  return count;
+}
+
+void optimise(HylicModule *module) {
+  for (auto &[ent_name, v] : module->entity_defs) {
+    OptimiseContext context;
+    context.entity_def = (EntityDef *)v;
+
+    int nodes_before = dump_node_counts ? count_entity_nodes(context.entity_def) : 0;
+
+    for (auto &[_, func] : context.entity_def->functions) {
+      // System modules share their builtins, which are only optimised once
+      if (func->frame_size >= 0) {
+        continue;
+      }
+
+      optimise_block(&context, func->body);
+      mark_frame_local(context.entity_def, func);
+    }
+
+    mark_parallel_safe(&context);
+
+    if (dump_node_counts) {
+      // Printed as a result, so tests can check what the pass removed
+      printf("%s => %d AST nodes before optimising, %d after\n", ent_name.c_str(), nodes_before,
+             count_entity_nodes(context.entity_def));
+    }
+  }
+}
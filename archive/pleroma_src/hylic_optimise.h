@@ -0,0 +1,13 @@
+#pragma once
+
+#include "hylic_ast.h"
+
+// Prints each entity's node count before and after optimise()
+extern bool dump_node_counts;
+
+// Run after typesolve(), before resolve().  Folds arithmetic and comparisons
+// of literals, calls to pure functions that return such an expression of
+// their arguments, and matches over literals, then drops unreachable match
+// arms and no-op statements such as comments.  Marks the functions that
+// are FuncStmt::parallel_safe and the OperatorExpr::frame_local strings.
+void optimise(HylicModule *module);
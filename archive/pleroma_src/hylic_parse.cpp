@@ -93,6 +93,81 @@ CType *parse_type(ParseContext *ctx) {
   return var_type;
 }
 
+// Arithmetic and comparisons, the higher the tighter they bind.  Anything
+// else is 0 and left for the end of the expression.
+int op_precedence(InfixOpType type) {
+  switch (type) {
+  case InfixOpType::Multiply:
+  case InfixOpType::Divide:
+    return 3;
+  case InfixOpType::Plus:
+  case InfixOpType::Minus:
+    return 2;
+  case InfixOpType::LessThan:
+  case InfixOpType::LessThanEqual:
+  case InfixOpType::GreaterThan:
+  case InfixOpType::GreaterThanEqual:
+  case InfixOpType::Equals:
+    return 1;
+  default:
+    return 0;
+  }
+}
+
+void reduce_binary_op(std::stack<AstNode *> &val_stack, InfixOpType type) {
+  auto right = val_stack.top();
+  val_stack.pop();
+  auto left = val_stack.top();
+  val_stack.pop();
+
+  switch (type) {
+  case InfixOpType::Plus:
+    val_stack.push(make_operator_expr(OperatorExpr::Plus, right, left));
+    break;
+  case InfixOpType::Minus:
+    val_stack.push(make_operator_expr(OperatorExpr::Minus, right, left));
+    break;
+  case InfixOpType::Multiply:
+    val_stack.push(make_operator_expr(OperatorExpr::Times, right, left));
+    break;
+  case InfixOpType::Divide:
+    val_stack.push(make_operator_expr(OperatorExpr::Divide, right, left));
+    break;
+  case InfixOpType::LessThan:
+    val_stack.push(make_boolean_expr(BooleanExpr::LessThan, left, right));
+    break;
+  case InfixOpType::LessThanEqual:
+    val_stack.push(make_boolean_expr(BooleanExpr::LessThanEqual, left, right));
+    break;
+  case InfixOpType::GreaterThan:
+    val_stack.push(make_boolean_expr(BooleanExpr::GreaterThan, left, right));
+    break;
+  case InfixOpType::GreaterThanEqual:
+    val_stack.push(make_boolean_expr(BooleanExpr::GreaterThanEqual, left, right));
+    break;
+  case InfixOpType::Equals:
+    val_stack.push(make_boolean_expr(BooleanExpr::Equals, left, right));
+    break;
+  default:
+    assert(false);
+  }
+}
+
+// Operators before this one that bind at least as tight are reduced first,
+// so a - b - c is (a - b) - c and a + b * c is a + (b * c)
+void push_binary_op(std::stack<InfixOp> &op_stack, std::stack<AstNode *> &val_stack, InfixOpType type, std::string name) {
+  while (!op_stack.empty() && op_precedence(op_stack.top().type) >= op_precedence(type)) {
+    reduce_binary_op(val_stack, op_stack.top().type);
+    op_stack.pop();
+  }
+
+  InfixOp op;
+  op.type = type;
+  op.n_args = 2;
+  op.name = name;
+  op_stack.push(op);
+}
+
 AstNode *parse_expr(ParseContext *context) {
   std::stack<InfixOp> op_stack;
   std::stack<AstNode *> val_stack;
@@ -165,6 +240,7 @@ AstNode *parse_expr(ParseContext *context) {
       context->ts->expect(TokenType::RightBracket);
 
       CType *list_type = new CType;
+      list_type->dtype = DType::Local;
       if (list.empty()) {
         list_type->basetype = PType::NotAssigned;
       } else {
@@ -282,48 +358,24 @@ AstNode *parse_expr(ParseContext *context) {
       op.n_args = 1;
       op.name = "Index";
       op_stack.push(op);
-    } else if (context->ts->check(TokenType::Plus)) {
-      context->ts->accept(TokenType::Plus);
-      InfixOp op;
-      op.type = InfixOpType::Plus;
-      op.n_args = 2;
-      op.name = "Plus";
-      op_stack.push(op);
-    } else if (context->ts->check(TokenType::LessThan)) {
-      context->ts->accept(TokenType::LessThan);
-      InfixOp op;
-      op.type = InfixOpType::LessThan;
-      op.n_args = 2;
-      op.name = "LessThan";
-      op_stack.push(op);
-    } else if (context->ts->check(TokenType::LessThanEqual)) {
-      context->ts->accept(TokenType::LessThanEqual);
-      InfixOp op;
-      op.type = InfixOpType::LessThanEqual;
-      op.n_args = 2;
-      op.name = "LessThanEqual";
-      op_stack.push(op);
-    } else if (context->ts->check(TokenType::GreaterThan)) {
-      context->ts->accept(TokenType::GreaterThan);
-      InfixOp op;
-      op.type = InfixOpType::GreaterThan;
-      op.n_args = 2;
-      op.name = "GreaterThan";
-      op_stack.push(op);
-    } else if (context->ts->check(TokenType::GreaterThanEqual)) {
-      context->ts->accept(TokenType::GreaterThanEqual);
-      InfixOp op;
-      op.type = InfixOpType::GreaterThanEqual;
-      op.n_args = 2;
-      op.name = "GreaterThanEqual";
-      op_stack.push(op);
-    } else if (context->ts->check(TokenType::EqualsEquals)) {
-      context->ts->accept(TokenType::EqualsEquals);
-      InfixOp op;
-      op.type = InfixOpType::Equals;
-      op.n_args = 2;
-      op.name = "Equals";
-      op_stack.push(op);
+    } else if (context->ts->accept(TokenType::Plus)) {
+      push_binary_op(op_stack, val_stack, InfixOpType::Plus, "Plus");
+    } else if (context->ts->accept(TokenType::Minus)) {
+      push_binary_op(op_stack, val_stack, InfixOpType::Minus, "Minus");
+    } else if (context->ts->accept(TokenType::Star)) {
+      push_binary_op(op_stack, val_stack, InfixOpType::Multiply, "Multiply");
+    } else if (context->ts->accept(TokenType::Slash)) {
+      push_binary_op(op_stack, val_stack, InfixOpType::Divide, "Divide");
+    } else if (context->ts->accept(TokenType::LessThan)) {
+      push_binary_op(op_stack, val_stack, InfixOpType::LessThan, "LessThan");
+    } else if (context->ts->accept(TokenType::LessThanEqual)) {
+      push_binary_op(op_stack, val_stack, InfixOpType::LessThanEqual, "LessThanEqual");
+    } else if (context->ts->accept(TokenType::GreaterThan)) {
+      push_binary_op(op_stack, val_stack, InfixOpType::GreaterThan, "GreaterThan");
+    } else if (context->ts->accept(TokenType::GreaterThanEqual)) {
+      push_binary_op(op_stack, val_stack, InfixOpType::GreaterThanEqual, "GreaterThanEqual");
+    } else if (context->ts->accept(TokenType::EqualsEquals)) {
+      push_binary_op(op_stack, val_stack, InfixOpType::Equals, "Equals");
     } else {
       // FIXME not sure if we should break here
       break;
@@ -338,34 +390,8 @@ AstNode *parse_expr(ParseContext *context) {
     InfixOp op = op_stack.top();
     op_stack.pop();
 
-    if (op.type == InfixOpType::LessThan || op.type == InfixOpType::LessThanEqual || op.type == InfixOpType::GreaterThan || op.type == InfixOpType::GreaterThanEqual || op.type == InfixOpType::Equals) {
-      auto expr1 = val_stack.top();
-      val_stack.pop();
-      auto expr2 = val_stack.top();
-      val_stack.pop();
-
-      if (op.type == InfixOpType::LessThan) {
-        val_stack.push(make_boolean_expr(BooleanExpr::LessThan, expr2, expr1));
-      } else if (op.type == InfixOpType::LessThanEqual) {
-        val_stack.push(make_boolean_expr(BooleanExpr::LessThan, expr2, expr1));
-      } else if (op.type == InfixOpType::GreaterThan) {
-        val_stack.push(make_boolean_expr(BooleanExpr::GreaterThan, expr2, expr1));
-      } else if (op.type == InfixOpType::GreaterThanEqual) {
-        val_stack.push(make_boolean_expr(BooleanExpr::GreaterThanEqual, expr2, expr1));
-      } else if (op.type == InfixOpType::Equals) {
-        val_stack.push(make_boolean_expr(BooleanExpr::Equals, expr2, expr1));
-      } else {
-        assert(false);
-      }
-    }
-
-    if (op.type == InfixOpType::Plus) {
-      auto expr1 = val_stack.top();
-      val_stack.pop();
-      auto expr2 = val_stack.top();
-      val_stack.pop();
-
-      val_stack.push(make_operator_expr(OperatorExpr::Plus, expr1, expr2));
+    if (op_precedence(op.type) > 0) {
+      reduce_binary_op(val_stack, op.type);
     }
 
     if (op.type == InfixOpType::Range) {
@@ -934,14 +960,19 @@ HylicModule *parse(std::string abs_mod_path, TokenStream *stream) {
     if (context.ts->accept(TokenType::Import)) {
       // ModuleStmt
       std::string mod_name = context.ts->accept(TokenType::Symbol)->lexeme;
+      std::string mod_path = mod_name;
       while (context.ts->accept(TokenType::ModUse)) {
-        mod_name += "►" + context.ts->accept(TokenType::Symbol)->lexeme;
+        auto part = context.ts->accept(TokenType::Symbol)->lexeme;
+        mod_name += "►" + part;
+        mod_path += "/" + part;
       }
       HylicModule *imported_mod;
       if (is_system_module(mod_name)) {
         imported_mod = load_system_module(system_import_to_enum(mod_name));
       } else {
-        panic("NYI");
+        // User modules are found relative to the importing file
+        auto dir = stream->filename.substr(0, stream->filename.find_last_of('/') + 1);
+        imported_mod = load_file(mod_name, dir + mod_path + ".plm");
       }
 
       eat_newlines(&context);
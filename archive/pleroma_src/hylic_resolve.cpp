@@ -0,0 +1,222 @@
+#include "hylic_resolve.h"
+#include "general_util.h"
+
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+struct ResolveScope {
+  std::map<std::string, int> slots;
+};
+
+// Layout of the frame being resolved.  Blocks open scopes, but their
+// bindings all get distinct slots in the one frame: nothing outlives a call,
+// and no body can see another function's frame, so a slot is all eval needs.
+struct ResolveContext {
+  EntityDef *entity_def;
+
+  std::vector<ResolveScope> scope_stack;
+  int frame_size = 0;
+};
+
+void push_scope(ResolveContext *context) {
+  context->scope_stack.push_back(ResolveScope());
+}
+
+void pop_scope(ResolveContext *context) {
+  context->scope_stack.pop_back();
+}
+
+int bind_local(ResolveContext *context, std::string sym) {
+  int slot = context->frame_size++;
+  context->scope_stack.back().slots[sym] = slot;
+  return slot;
+}
+
+// Same search order as find_symbol(): locals from the innermost scope out,
+// then entity fields.  Everything else stays dynamic.
+bool resolve_symbol(ResolveContext *context, SymbolNode *node) {
+  for (auto it = context->scope_stack.rbegin(); it != context->scope_stack.rend(); ++it) {
+    auto found_it = it->slots.find(node->sym);
+    if (found_it != it->slots.end()) {
+      node->scope = SymbolScope::Local;
+      node->slot = found_it->second;
+      return true;
+    }
+  }
+
+  auto field = context->entity_def->field_slots.find(node->sym);
+  if (field != context->entity_def->field_slots.end()) {
+    node->scope = SymbolScope::Field;
+    node->slot = field->second;
+    return true;
+  }
+
+  node->scope = SymbolScope::Dynamic;
+  node->slot = -1;
+  return false;
+}
+
+void resolve_node(ResolveContext *context, AstNode *node);
+
+void resolve_block(ResolveContext *context, std::vector<AstNode *> &block) {
+  push_scope(context);
+  for (auto k : block) {
+    resolve_node(context, k);
+  }
+  pop_scope(context);
+}
+
+// Lays out a fresh frame for body with params in its first slots, returns
+// the frame size
+int resolve_frame(ResolveContext *context, std::vector<std::string> &params, std::vector<AstNode *> &body) {
+  ResolveContext frame_context;
+  frame_context.entity_def = context->entity_def;
+
+  push_scope(&frame_context);
+  for (auto &k : params) {
+    bind_local(&frame_context, k);
+  }
+  resolve_block(&frame_context, body);
+  pop_scope(&frame_context);
+
+  return frame_context.frame_size;
+}
+
+void resolve_node(ResolveContext *context, AstNode *node) {
+  switch (node->type) {
+
+  case AstNodeType::SymbolNode: {
+    resolve_symbol(context, (SymbolNode *)node);
+  } break;
+
+  case AstNodeType::AssignmentStmt: {
+    auto ass_stmt = (AssignmentStmt *)node;
+
+    // The value is evaluated before the target is bound
+    resolve_node(context, ass_stmt->value);
+
+    if (ass_stmt->sym->type == AstNodeType::SymbolNode) {
+      auto sym = (SymbolNode *)ass_stmt->sym;
+      if (!resolve_symbol(context, sym)) {
+        sym->scope = SymbolScope::Local;
+        sym->slot = bind_local(context, sym->sym);
+      }
+    } else {
+      resolve_node(context, ass_stmt->sym);
+    }
+  } break;
+
+  case AstNodeType::OperatorExpr: {
+    auto op_expr = (OperatorExpr *)node;
+    resolve_node(context, op_expr->term1);
+    resolve_node(context, op_expr->term2);
+  } break;
+
+  case AstNodeType::BooleanExpr: {
+    auto bool_expr = (BooleanExpr *)node;
+    resolve_node(context, bool_expr->term1);
+    resolve_node(context, bool_expr->term2);
+  } break;
+
+  case AstNodeType::IndexNode: {
+    auto ind_node = (IndexNode *)node;
+    resolve_node(context, ind_node->list);
+    resolve_node(context, ind_node->accessor);
+  } break;
+
+  case AstNodeType::RangeNode: {
+    auto range_node = (RangeNode *)node;
+    resolve_node(context, range_node->range_start);
+    resolve_node(context, range_node->range_end);
+  } break;
+
+  case AstNodeType::ReturnNode: {
+    resolve_node(context, ((ReturnNode *)node)->expr);
+  } break;
+
+  case AstNodeType::ListNode: {
+    for (auto k : ((ListNode *)node)->list) {
+      resolve_node(context, k);
+    }
+  } break;
+
+  case AstNodeType::MessageNode: {
+    auto msg_node = (MessageNode *)node;
+    resolve_node(context, msg_node->entity_ref);
+    for (auto k : msg_node->args) {
+      resolve_node(context, k);
+    }
+  } break;
+
+  case AstNodeType::ForeignFunc: {
+    for (auto k : ((ForeignFuncCall *)node)->args) {
+      resolve_node(context, k);
+    }
+  } break;
+
+  case AstNodeType::WhileStmt: {
+    auto while_node = (WhileStmt *)node;
+    resolve_node(context, while_node->generator);
+    resolve_block(context, while_node->body);
+  } break;
+
+  case AstNodeType::ForStmt: {
+    auto for_node = (ForStmt *)node;
+    resolve_node(context, for_node->generator);
+
+    push_scope(context);
+    for_node->slot = bind_local(context, for_node->sym);
+    resolve_block(context, for_node->body);
+    pop_scope(context);
+  } break;
+
+  case AstNodeType::MatchNode: {
+    auto match_node = (MatchNode *)node;
+    resolve_node(context, match_node->match_expr);
+    for (auto &match_case : match_node->cases) {
+      resolve_node(context, std::get<0>(match_case));
+      resolve_block(context, std::get<1>(match_case));
+    }
+  } break;
+
+  case AstNodeType::PromiseResNode: {
+    auto res_node = (PromiseResNode *)node;
+    resolve_symbol(context, res_node->promise);
+
+    std::vector<std::string> params = {res_node->sym};
+    res_node->frame_size = resolve_frame(context, params, res_node->body);
+  } break;
+
+  case AstNodeType::ModUseNode: {
+    // Evaluated in a frame of the imported module, which has no locals
+    ResolveContext mod_context;
+    mod_context.entity_def = context->entity_def;
+    push_scope(&mod_context);
+    resolve_node(&mod_context, ((ModUseNode *)node)->accessor);
+    pop_scope(&mod_context);
+  } break;
+
+  default:
+    break;
+  }
+}
+
+void resolve(HylicModule *module) {
+  for (auto &[ent_name, v] : module->entity_defs) {
+    auto entity_def = (EntityDef *)v;
+
+    ResolveContext context;
+    context.entity_def = entity_def;
+
+    for (auto &[_, func] : entity_def->functions) {
+      // System modules share their builtins, which are resolved once
+      if (func->frame_size >= 0) {
+        continue;
+      }
+
+      func->frame_size = resolve_frame(&context, func->args, func->body);
+    }
+  }
+}
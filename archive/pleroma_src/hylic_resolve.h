@@ -0,0 +1,9 @@
+#pragma once
+
+#include "hylic_ast.h"
+
+// Lexical addressing, run after typesolve().  Every function gets a flat
+// frame: each binding in it (arguments, lets, loop variables) owns one slot
+// and symbols are pointed at their slot or at an entity field, so eval never
+// has to search scopes by name.
+void resolve(HylicModule *module);
@@ -73,6 +73,15 @@ bool exact_match(CType a, CType b) {
   return true;
 }
 
+OperandKind operand_kind(CType ctype) {
+  if (in(ctype.basetype, {PType::u8, PType::u16, PType::u32, PType::u64})) {
+    return OperandKind::Number;
+  } else if (ctype.basetype == PType::str) {
+    return OperandKind::String;
+  }
+  return OperandKind::Dynamic;
+}
+
 CType *typescope_has(TypeContext *context, std::string sym) {
   for (auto it = context->scope_stack.rbegin(); it != context->scope_stack.rend(); ++it) {
     auto found_it = it->table.find(sym);
@@ -85,7 +94,7 @@ CType *typescope_has(TypeContext *context, std::string sym) {
 }
 
 bool built_in_func(std::string func_name) {
-  std::vector<std::string> builtins = {"append", "len"};
+  std::vector<std::string> builtins = {"append", "len", "after", "every", "cancel-timer", "promise-timeout", "cancel-promise", "list-sum", "list-min", "list-max", "list-find", "list-map", "list-filter", "list-pmap"};
   return std::find(builtins.begin(), builtins.end(), func_name) != builtins.end();
 }
 
@@ -138,7 +147,9 @@ CType typesolve_sub(TypeContext* context, AstNode *node) {
     auto match_expr = typesolve_sub(context, match_node->match_expr);
 
     for (auto &[case_expr, case_body] : match_node->cases) {
-      typesolve_sub(context, case_expr);
+      if (case_expr->type != AstNodeType::FallthroughExpr) {
+        typesolve_sub(context, case_expr);
+      }
       for (auto &k : case_body) {
         typesolve_sub(context, k);
       }
@@ -157,6 +168,12 @@ CType typesolve_sub(TypeContext* context, AstNode *node) {
       throw TypesolverException("", 0, 0, "Operator expression types don't match: " + ctype_to_string(&lexpr) + ", " + ctype_to_string(&rexpr));
     }
 
+    op_expr->operands = operand_kind(lexpr);
+    if (op_expr->operands == OperandKind::String && op_expr->op != OperatorExpr::Plus) {
+      throw TypesolverException("", 0, 0, "Strings can only be joined with +");
+    }
+
+    op_expr->ctype = lexpr;
     return lexpr;
   } break;
 
@@ -165,10 +182,36 @@ CType typesolve_sub(TypeContext* context, AstNode *node) {
   } break;
 
   case AstNodeType::BooleanExpr: {
+    auto bool_expr = (BooleanExpr *)node;
+
+    CType lexpr = typesolve_sub(context, bool_expr->term1);
+    CType rexpr = typesolve_sub(context, bool_expr->term2);
+
+    // Anything else is left to the runtime checks
+    if (exact_match(lexpr, rexpr)) {
+      bool_expr->operands = operand_kind(lexpr);
+      if (bool_expr->operands == OperandKind::String && bool_expr->op != BooleanExpr::Equals) {
+        throw TypesolverException("", 0, 0, "Strings can only be compared with ==");
+      }
+    }
+
     return node->ctype;
   } break;
 
   case AstNodeType::ListNode: {
+    auto list_node = (ListNode *)node;
+
+    // Unboxed literals were typed by the parser, anything else takes the type of its elements
+    if (!list_node->list.empty()) {
+      CType elem_type = typesolve_sub(context, list_node->list[0]);
+      for (auto elem : list_node->list) {
+        if (!exact_match(typesolve_sub(context, elem), elem_type)) {
+          throw TypesolverException("nil", 0, 0, "List elements must all have type " + ctype_to_string(&elem_type));
+        }
+      }
+      *list_node->ctype.subtype = elem_type;
+    }
+
     return node->ctype;
   } break;
 
@@ -259,6 +302,26 @@ CType typesolve_sub(TypeContext* context, AstNode *node) {
 
     // HACK
     if (built_in_func(msg_node->function_name)) {
+      // Elements have to be of the list's type, operators specialised on it
+      // read them without checking
+      if (msg_node->function_name == "append" && msg_node->args.size() == 2) {
+        auto list_type = typesolve_sub(context, msg_node->args[0]);
+        auto elem_type = typesolve_sub(context, msg_node->args[1]);
+        if (list_type.basetype == PType::List && !exact_match(*list_type.subtype, elem_type)) {
+          throw TypesolverException("", 0, 0, "Appended element doesn't match the list's type: " + ctype_to_string(list_type.subtype) + ", " + ctype_to_string(&elem_type));
+        }
+      }
+      // Timer ids are plain numbers so they can be stored and cancelled later
+      if (in(msg_node->function_name, {"after", "every"})) {
+        return *lu8();
+      }
+      if (in(msg_node->function_name, {"len", "list-sum", "list-min", "list-max", "list-find"})) {
+        return *lu8();
+      }
+      // A mapped list keeps its type, the checker doesn't look inside the function
+      if (in(msg_node->function_name, {"list-map", "list-filter", "list-pmap"})) {
+        return typesolve_sub(context, msg_node->args[0]);
+      }
       return CType();
     }
 
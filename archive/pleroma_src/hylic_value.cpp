@@ -0,0 +1,144 @@
+#include "hylic_value.h"
+#include "hylic_ast.h"
+#include "general_util.h"
+
+Value make_nop_value() {
+  Value value;
+  value.tag = ValueTag::Nop;
+  return value;
+}
+
+Value make_number_value(s64 number) {
+  Value value;
+  value.tag = ValueTag::Number;
+  value.number = number;
+  return value;
+}
+
+Value make_boolean_value(bool boolean) {
+  Value value;
+  value.tag = ValueTag::Boolean;
+  value.boolean = boolean;
+  return value;
+}
+
+Value make_entity_ref_value(int node_id, int vat_id, int entity_id) {
+  Value value;
+  value.tag = ValueTag::EntityRef;
+  value.node_id = node_id;
+  value.ref.vat_id = vat_id;
+  value.ref.entity_id = entity_id;
+  return value;
+}
+
+Value make_promise_value(int promise_id) {
+  Value value;
+  value.tag = ValueTag::Promise;
+  value.promise_id = promise_id;
+  return value;
+}
+
+Value make_object_value(AstNode *object) {
+  Value value;
+  value.tag = ValueTag::Object;
+  value.object = object;
+  return value;
+}
+
+Value make_value(AstNode *node) {
+  if (!node) {
+    return Value();
+  }
+
+  switch (node->type) {
+  case AstNodeType::Nop:
+    return make_nop_value();
+  case AstNodeType::NumberNode:
+    return make_number_value(((NumberNode *)node)->value);
+  case AstNodeType::BooleanNode:
+    return make_boolean_value(((BooleanNode *)node)->value);
+  case AstNodeType::EntityRefNode: {
+    auto ref = (EntityRefNode *)node;
+    return make_entity_ref_value(ref->node_id, ref->vat_id, ref->entity_id);
+  }
+  case AstNodeType::PromiseNode:
+    return make_promise_value(((PromiseNode *)node)->promise_id);
+  default:
+    return make_object_value(node);
+  }
+}
+
+AstNode *make_value_node(Value value) {
+  switch (value.tag) {
+  case ValueTag::Empty:
+    return nullptr;
+  case ValueTag::Nop:
+    return make_nop();
+  case ValueTag::Number:
+    return make_number(value.number);
+  case ValueTag::Boolean:
+    return make_boolean(value.boolean);
+  case ValueTag::EntityRef:
+    return make_entity_ref(value.node_id, value.ref.vat_id, value.ref.entity_id);
+  case ValueTag::Promise:
+    return make_promise_node(value.promise_id);
+  case ValueTag::Object:
+    return value.object;
+  }
+
+  return nullptr;
+}
+
+bool value_bound(const Value &value) {
+  return value.tag != ValueTag::Empty;
+}
+
+s64 value_number(const Value &value) {
+  if (value.tag != ValueTag::Number) {
+    panic("Expected a number, but got " + value_tag_to_string(value.tag));
+  }
+  return value.number;
+}
+
+bool value_boolean(const Value &value) {
+  if (value.tag != ValueTag::Boolean) {
+    panic("Expected a boolean, but got " + value_tag_to_string(value.tag));
+  }
+  return value.boolean;
+}
+
+int value_promise(const Value &value) {
+  if (value.tag != ValueTag::Promise) {
+    panic("Expected a promise, but got " + value_tag_to_string(value.tag));
+  }
+  return value.promise_id;
+}
+
+std::string value_tag_to_string(ValueTag tag) {
+  switch (tag) {
+  case ValueTag::Empty: return "Empty";
+  case ValueTag::Nop: return "Nop";
+  case ValueTag::Number: return "Number";
+  case ValueTag::Boolean: return "Boolean";
+  case ValueTag::EntityRef: return "EntityRef";
+  case ValueTag::Promise: return "Promise";
+  case ValueTag::Object: return "Object";
+  }
+
+  return "?";
+}
+
+std::string stringify_value(const Value &value) {
+  switch (value.tag) {
+  case ValueTag::Empty: return "empty";
+  case ValueTag::Nop: return "nop";
+  case ValueTag::Number: return std::to_string(value.number);
+  case ValueTag::Boolean: return value.boolean ? "#t" : "#f";
+  case ValueTag::EntityRef:
+    return "entity " + std::to_string(value.node_id) + ":" + std::to_string(value.ref.vat_id) + ":" + std::to_string(value.ref.entity_id);
+  case ValueTag::Promise: return "promise " + std::to_string(value.promise_id);
+  case ValueTag::Object: return stringify_value_node(value.object);
+  }
+
+  return "";
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "common.h"
+#include <string>
+
+struct AstNode;
+
+enum class ValueTag : u8 {
+  // An unbound slot
+  Empty,
+  Nop,
+  Number,
+  Boolean,
+  EntityRef,
+  Promise,
+  // Strings, lists and anything else that lives in the AST
+  Object
+};
+
+struct EntityRefValue {
+  s32 vat_id;
+  s32 entity_id;
+};
+
+// What eval works on.  Numbers, booleans, entity refs and promises are
+// immediates, so arithmetic and messaging don't touch the heap; only objects
+// are AstNodes owned by the vat's GC.
+struct Value {
+  ValueTag tag = ValueTag::Empty;
+  // Node of an EntityRef
+  s32 node_id = 0;
+
+  union {
+    s64 number = 0;
+    bool boolean;
+    EntityRefValue ref;
+    s32 promise_id;
+    AstNode *object;
+  };
+};
+
+Value make_nop_value();
+Value make_number_value(s64 number);
+Value make_boolean_value(bool boolean);
+Value make_entity_ref_value(int node_id, int vat_id, int entity_id);
+Value make_promise_value(int promise_id);
+Value make_object_value(AstNode *object);
+
+// Immediates for the node types that have one, the node itself otherwise
+Value make_value(AstNode *node);
+// Boxes immediates in a fresh node, objects are returned as is
+AstNode *make_value_node(Value value);
+
+bool value_bound(const Value &value);
+
+// Panic on a mismatched tag, like safe_ncast()
+s64 value_number(const Value &value);
+bool value_boolean(const Value &value);
+int value_promise(const Value &value);
+
+std::string value_tag_to_string(ValueTag tag);
+std::string stringify_value(const Value &value);
@@ -0,0 +1,259 @@
+#include "hylic_vm.h"
+#include "general_util.h"
+#include "other.h"
+
+Value vm_pop(EvalContext *context) {
+  auto value = context->vm_stack.back();
+  context->vm_stack.pop_back();
+  return value;
+}
+
+// Pops n values, first pushed first
+ArenaVector<Value> vm_pop_n(EvalContext *context, int n) {
+  ArenaVector<Value> values(context->vm_stack.end() - n, context->vm_stack.end(), context->arena);
+  context->vm_stack.resize(context->vm_stack.size() - n);
+  return values;
+}
+
+Value run_loop(EvalContext *context, Chunk *chunk) {
+  auto &stack = context->vm_stack;
+  auto &code = chunk->code;
+  auto &constants = chunk->constants;
+
+  int pc = 0;
+  while (true) {
+    const Instr &instr = code[pc++];
+    context->reductions++;
+
+    switch (instr.op) {
+    case Hlcn::Const: {
+      stack.push_back(chunk->values[instr.a]);
+    } break;
+
+    case Hlcn::Pop: {
+      stack.pop_back();
+    } break;
+
+    case Hlcn::Dup: {
+      stack.push_back(stack.back());
+    } break;
+
+    case Hlcn::LoadLocal: {
+      // Unbound slots fall through for the error
+      Value value = cfs(context).locals[instr.a];
+      stack.push_back(value_bound(value) ? value : find_symbol(context, ((SymbolNode *)constants[instr.b])->sym));
+    } break;
+
+    case Hlcn::StoreLocal: {
+      cfs(context).locals[instr.a] = stack.back();
+    } break;
+
+    case Hlcn::LoadField: {
+      Value value = cfs(context).entity->data[instr.a];
+      stack.push_back(value_bound(value) ? value : find_symbol(context, ((SymbolNode *)constants[instr.b])->sym));
+    } break;
+
+    case Hlcn::StoreField: {
+      cfs(context).entity->data[instr.a] = stack.back();
+    } break;
+
+    case Hlcn::LoadDynamic: {
+      stack.push_back(find_symbol(context, ((SymbolNode *)constants[instr.b])->sym));
+    } break;
+
+    case Hlcn::StoreDynamic: {
+      assign_symbol(context, (SymbolNode *)constants[instr.b], stack.back());
+    } break;
+
+    case Hlcn::Self: {
+      auto eadd = cfs(context).entity->address;
+      stack.push_back(make_entity_ref_value(eadd.node_id, eadd.vat_id, eadd.entity_id));
+    } break;
+
+    case Hlcn::Operator: {
+      auto n2 = vm_pop(context);
+      auto n1 = vm_pop(context);
+      stack.push_back(eval_operator(context, (OperatorExpr::Op)instr.a, n1, n2));
+    } break;
+
+    case Hlcn::Compare: {
+      auto term2 = vm_pop(context);
+      auto term1 = vm_pop(context);
+      stack.push_back(eval_comparison((BooleanExpr::Op)instr.a, term1, term2));
+    } break;
+
+    // An OperatorExpr pushes its right operand first, a BooleanExpr its left
+    case Hlcn::NumberOp: {
+      auto left = vm_pop(context);
+      auto &right = stack.back();
+      right = eval_number_operator((OperatorExpr::Op)instr.a, left.number, right.number);
+    } break;
+
+    case Hlcn::Concat: {
+      auto left = vm_pop(context);
+      auto right = vm_pop(context);
+      stack.push_back(eval_concat(context, left, right, instr.a));
+    } break;
+
+    case Hlcn::NumberCompare: {
+      auto right = vm_pop(context);
+      auto &left = stack.back();
+      left = eval_number_comparison((BooleanExpr::Op)instr.a, left.number, right.number);
+    } break;
+
+    case Hlcn::StringEquals: {
+      auto right = vm_pop(context);
+      auto left = vm_pop(context);
+      stack.push_back(eval_string_equals(left, right));
+    } break;
+
+    case Hlcn::MatchJump: {
+      auto mca_eval = vm_pop(context);
+      if (!match_case_equal(stack.back(), mca_eval)) {
+        pc = instr.a;
+      }
+    } break;
+
+    case Hlcn::MatchTable: {
+      int taken = match_table_case((MatchNode *)constants[instr.a], vm_pop(context));
+      auto &targets = chunk->jump_tables[instr.b];
+      pc = taken == -1 ? targets.back() : targets[taken];
+    } break;
+
+    case Hlcn::Jump: {
+      pc = instr.a;
+    } break;
+
+    case Hlcn::JumpIfFalse: {
+      if (!value_boolean(vm_pop(context))) {
+        pc = instr.a;
+      }
+    } break;
+
+    case Hlcn::MakeList: {
+      auto literal = (ListNode *)constants[instr.b];
+      auto list = list_from_values(context, vm_pop_n(context, instr.a), literal->ctype.subtype);
+      stack.push_back(make_object_value(list));
+    } break;
+
+    case Hlcn::ShareList: {
+      stack.push_back(make_object_value(share_list((ListNode *)constants[instr.a])));
+    } break;
+
+    case Hlcn::Range: {
+      auto range_end = vm_pop(context);
+      auto range_start = vm_pop(context);
+      stack.push_back(eval_range(range_start, range_end));
+    } break;
+
+    case Hlcn::Index: {
+      auto accessor = vm_pop(context);
+      auto list = vm_pop(context);
+      stack.push_back(eval_index(list, accessor));
+    } break;
+
+    case Hlcn::StoreIndex: {
+      auto accessor = vm_pop(context);
+      auto list = vm_pop(context);
+      store_index(context, list, accessor, stack.back());
+    } break;
+
+    case Hlcn::ForPrep: {
+      context->vm_iters.push_back(make_list_iter(vm_pop(context)));
+    } break;
+
+    case Hlcn::ForRange: {
+      auto range_end = vm_pop(context);
+      auto range_start = vm_pop(context);
+      context->vm_iters.push_back(make_range_iter(range_start, range_end));
+    } break;
+
+    case Hlcn::ForNext: {
+      if (!for_iter_next(&context->vm_iters.back(), &cfs(context).locals[instr.a])) {
+        context->vm_iters.pop_back();
+        pc = instr.b;
+      }
+    } break;
+
+    case Hlcn::Call: {
+      auto site = (MessageNode *)constants[instr.a];
+      int argc = instr.b;
+
+      Value result;
+      if (is_builtin(site->method_id)) {
+        vm_pop(context);
+        auto args = vm_pop_n(context, argc);
+        eval_builtin(context, site->method_id, args, &result);
+      } else {
+        // Arguments are read in place, the callee copies them into its frame
+        result = eval_call_site(context, site, stack.back(), &stack[stack.size() - argc - 1], argc);
+        stack.resize(stack.size() - argc - 1);
+      }
+      stack.push_back(result);
+    } break;
+
+    case Hlcn::Send: {
+      auto site = (MessageNode *)constants[instr.a];
+      auto target = vm_pop(context);
+      auto args = vm_pop_n(context, instr.b);
+
+      Value result;
+      if (!eval_builtin(context, site->method_id, args, &result)) {
+        result = eval_message_node(context, target, CommMode::Async, site->method_id, std::vector<Value>(args.begin(), args.end()));
+      }
+      stack.push_back(result);
+    } break;
+
+    case Hlcn::CreateEntity: {
+      stack.push_back(eval_create_entity(context, (CreateEntityNode *)constants[instr.a]));
+    } break;
+
+    case Hlcn::Foreign: {
+      auto ffc = (ForeignFuncCall *)constants[instr.a];
+      std::vector<Value> args(stack.end() - instr.b, stack.end());
+      stack.resize(stack.size() - instr.b);
+      flatten_strings(context, args);
+      stack.push_back(ffc->foreign_func(context, args));
+    } break;
+
+    case Hlcn::EnterModule: {
+      enter_module(context, ((ModUseNode *)constants[instr.a])->mod_name);
+    } break;
+
+    case Hlcn::LeaveModule: {
+      pop_stack_frame(context);
+    } break;
+
+    case Hlcn::OnResolve: {
+      auto prom_sym = vm_pop(context);
+      stack.push_back(eval_on_resolve(context, (PromiseResNode *)constants[instr.a], prom_sym));
+    } break;
+
+    case Hlcn::Return: {
+      return vm_pop(context);
+    } break;
+
+    case Hlcn::Fail: {
+      throw PleromaException(((StringNode *)constants[instr.a])->value.c_str());
+    } break;
+    }
+  }
+}
+
+Value run_chunk(EvalContext *context, Chunk *chunk) {
+  if (!chunk) {
+    panic("Running a body that was never compiled");
+  }
+
+  // Calls nest on the same operand stack
+  int stack_base = context->vm_stack.size();
+  int iter_base = context->vm_iters.size();
+
+  try {
+    return run_loop(context, chunk);
+  } catch (...) {
+    context->vm_stack.resize(stack_base);
+    context->vm_iters.resize(iter_base);
+    throw;
+  }
+}
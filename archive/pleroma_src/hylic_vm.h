@@ -0,0 +1,8 @@
+#pragma once
+
+#include "hylic_compiler.h"
+#include "hylic_eval.h"
+
+// Runs a compiled body in the current stack frame, the bytecode counterpart
+// of eval_block()
+Value run_chunk(EvalContext *context, Chunk *chunk);
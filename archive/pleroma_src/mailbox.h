@@ -0,0 +1,166 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+// Bounded lock-free ring (Vyukov), any number of producers and one consumer.
+// Each cell carries a sequence number telling producers and the consumer
+// whose turn it is, so neither side takes a lock.  Values are moved in and
+// out of the cells, so a push or pop never allocates.
+template <typename T, size_t Capacity>
+struct MpscRing {
+  static_assert((Capacity & (Capacity - 1)) == 0, "MpscRing capacity must be a power of two");
+
+  struct Cell {
+    std::atomic<size_t> seq;
+    T data;
+  };
+
+  Cell cells[Capacity];
+
+  alignas(64) std::atomic<size_t> tail{0};
+  alignas(64) size_t head = 0;
+
+  MpscRing() {
+    for (size_t k = 0; k < Capacity; ++k) {
+      cells[k].seq.store(k, std::memory_order_relaxed);
+    }
+  }
+
+  // Leaves value untouched when the ring is full
+  bool try_push(T &value) {
+    size_t pos = tail.load(std::memory_order_relaxed);
+    Cell *cell;
+
+    while (true) {
+      cell = &cells[pos & (Capacity - 1)];
+      size_t seq = cell->seq.load(std::memory_order_acquire);
+      intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+      if (diff == 0) {
+        if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        // Full
+        return false;
+      } else {
+        pos = tail.load(std::memory_order_relaxed);
+      }
+    }
+
+    cell->data = std::move(value);
+    cell->seq.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer only
+  bool try_pop(T &value) {
+    Cell *cell = &cells[head & (Capacity - 1)];
+    size_t seq = cell->seq.load(std::memory_order_acquire);
+
+    if ((intptr_t)seq - (intptr_t)(head + 1) < 0) {
+      return false;
+    }
+
+    value = std::move(cell->data);
+    cell->seq.store(head + Capacity, std::memory_order_release);
+    head++;
+    return true;
+  }
+
+  // False while a producer has claimed a cell but not yet filled it
+  bool drained() { return tail.load(std::memory_order_acquire) == head; }
+};
+
+// One priority lane of a mailbox.  When the ring is full, producers fall back
+// to a locked overflow list rather than block: a burner may be the consumer
+// of the very mailbox it is pushing into.  Once anything has overflowed,
+// producers keep using the overflow until the consumer drains it, so messages
+// from a single sender are never reordered.  Only the overflow allocates.
+template <typename T, size_t Capacity>
+struct MailboxLane {
+  MpscRing<T, Capacity> ring;
+
+  std::mutex overflow_mtx;
+  std::deque<T> overflow;
+  std::atomic<int> n_overflow{0};
+
+  // Overflowed messages taken by the consumer, drained before the ring
+  std::deque<T> spill;
+
+  void push(T &value) {
+    if (n_overflow.load(std::memory_order_acquire) == 0 && ring.try_push(value)) {
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(overflow_mtx);
+    overflow.push_back(std::move(value));
+    n_overflow++;
+  }
+
+  bool pop(T &value) {
+    if (!spill.empty()) {
+      value = std::move(spill.front());
+      spill.pop_front();
+      return true;
+    }
+
+    if (ring.try_pop(value)) {
+      return true;
+    }
+
+    // Overflowed messages are newer than everything in the ring, so only take
+    // them once the ring is fully drained
+    if (n_overflow.load(std::memory_order_acquire) > 0 && ring.drained()) {
+      std::lock_guard<std::mutex> lock(overflow_mtx);
+      spill.swap(overflow);
+      n_overflow = 0;
+    }
+
+    if (!spill.empty()) {
+      value = std::move(spill.front());
+      spill.pop_front();
+      return true;
+    }
+
+    return false;
+  }
+};
+
+const size_t SYSTEM_LANE_SIZE = 64;
+const size_t USER_LANE_SIZE = 256;
+
+// Per-vat mailbox, any thread can push, only the burner running the vat pops.
+// The system lane is always drained first.
+template <typename T>
+struct Mailbox {
+  MailboxLane<T, SYSTEM_LANE_SIZE> system;
+  MailboxLane<T, USER_LANE_SIZE> user;
+
+  std::atomic<int> pending{0};
+
+  void push(T value, bool system_msg) {
+    if (system_msg) {
+      system.push(value);
+    } else {
+      user.push(value);
+    }
+    pending++;
+  }
+
+  bool pop(T &value) {
+    if (!system.pop(value) && !user.pop(value)) {
+      return false;
+    }
+
+    pending--;
+    return true;
+  }
+
+  bool empty() { return pending.load() == 0; }
+};
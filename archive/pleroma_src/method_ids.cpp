@@ -0,0 +1,59 @@
+#include "method_ids.h"
+#include "general_util.h"
+
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+
+// Function-local so modules loaded during static initialisation can intern
+struct MethodTable {
+  std::shared_mutex mtx;
+  std::map<MethodId, std::string> names;
+};
+
+MethodTable &method_table() {
+  static MethodTable table;
+  return table;
+}
+
+MethodId intern_method(const std::string &name) {
+  MethodId method_id = method_hash(name.c_str());
+  MethodTable &table = method_table();
+
+  {
+    std::shared_lock<std::shared_mutex> lock(table.mtx);
+    auto found = table.names.find(method_id);
+    if (found != table.names.end()) {
+      if (found->second != name) {
+        panic("Method id collision between " + found->second + " and " + name);
+      }
+      return method_id;
+    }
+  }
+
+  if (method_id == NO_METHOD) {
+    panic("Method name " + name + " hashes to the reserved id");
+  }
+
+  std::unique_lock<std::shared_mutex> lock(table.mtx);
+  auto [found, inserted] = table.names.emplace(method_id, name);
+  if (!inserted && found->second != name) {
+    panic("Method id collision between " + found->second + " and " + name);
+  }
+
+  return method_id;
+}
+
+std::string method_name(MethodId method_id) {
+  MethodTable &table = method_table();
+
+  std::shared_lock<std::shared_mutex> lock(table.mtx);
+  auto found = table.names.find(method_id);
+  if (found != table.names.end()) {
+    return found->second;
+  }
+
+  char buf[16];
+  snprintf(buf, sizeof(buf), "#%08x", method_id);
+  return buf;
+}
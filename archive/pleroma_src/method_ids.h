@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+
+#include "common.h"
+
+// Function names are interned into method ids when modules are loaded, and
+// messages carry the id rather than the name.  The id is the FNV-1a hash of
+// the name, so every node agrees on it without exchanging tables; interning
+// only records the name for tracing and catches collisions.
+typedef u32 MethodId;
+
+const MethodId NO_METHOD = 0;
+
+constexpr MethodId method_hash(const char *name, MethodId hash = 2166136261u) {
+  return *name ? method_hash(name + 1, (hash ^ (u8)*name) * 16777619u) : hash;
+}
+
+MethodId intern_method(const std::string &name);
+
+// Tracing only, ids that were never interned here print as a hex number
+std::string method_name(MethodId method_id);
+
+const MethodId MAIN_METHOD = method_hash("main");
+const MethodId CREATE_METHOD = method_hash("create");
@@ -8,7 +8,9 @@
 #include "hylic_eval.h"
 #include "other.h"
 #include "pleroma.h"
+#include "scheduler.h"
 #include <arpa/inet.h>
+#include <atomic>
 #include <cstdio>
 #include <cstdlib>
 #include <enet/enet.h>
@@ -16,17 +18,28 @@
 #include <immintrin.h>
 #include <map>
 #include <string>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
 #include <tuple>
+#include <unistd.h>
 #include <vector>
 
 int pleroma_nodes_n = 1;
 
 moodycamel::ConcurrentQueue<Msg> net_out_queue;
-std::queue<Msg> net_in_queue;
 
-moodycamel::ConcurrentQueue<Vat *> net_vats;
+// The net loop sleeps in epoll on the ENet socket and an eventfd that
+// burners poke when they queue outbound messages
+struct Reactor {
+  int epoll_fd = -1;
+  int wake_fd = -1;
+  std::atomic<bool> sleeping{false};
+} reactor;
+
+// ENet still needs servicing for pings and retransmits while peers are connected
+const int ENET_SERVICE_MS = 50;
+const int MAX_REACTOR_EVENTS = 8;
 
-std::map<int, std::vector<Msg>> sort_queue;
 
 struct PleromaNetwork {
   ENetHost *server;
@@ -93,12 +106,66 @@ void assign_cluster_info_msg(enet_uint32 host, enet_uint16 port) {
   send_msg(address, message);
 }
 
+void init_reactor() {
+  reactor.epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+  reactor.wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (reactor.epoll_fd < 0 || reactor.wake_fd < 0) {
+    panic("Failed to create net reactor");
+  }
+
+  epoll_event ev = {};
+  ev.events = EPOLLIN;
+
+  ev.data.fd = pnet.server->socket;
+  epoll_ctl(reactor.epoll_fd, EPOLL_CTL_ADD, pnet.server->socket, &ev);
+
+  ev.data.fd = reactor.wake_fd;
+  epoll_ctl(reactor.epoll_fd, EPOLL_CTL_ADD, reactor.wake_fd, &ev);
+}
+
+void wake_reactor() {
+  // Pairs with the fence in net_loop() before it rechecks the queue
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (reactor.wake_fd >= 0 && reactor.sleeping.exchange(false)) {
+    u64 one = 1;
+    write(reactor.wake_fd, &one, sizeof(one));
+  }
+}
+
+void send_net_msg(Msg m) {
+  // Sent to the void
+  if (m.node_id == -1) {
+    return;
+  }
+
+  net_out_queue.enqueue(std::move(m));
+  wake_reactor();
+}
+
 void net_loop() {
   ENetEvent event;
   romabuf::PleromaMessage message;
 
-  // FIXME get rid of wait after moving to new queue system
-  while (enet_host_service(pnet.server, &event, 1) > 0) {
+  int timeout = pnet.peers.empty() ? -1 : ENET_SERVICE_MS;
+
+  reactor.sleeping = true;
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (net_out_queue.size_approx() > 0) {
+    timeout = 0;
+  }
+
+  epoll_event events[MAX_REACTOR_EVENTS];
+  int n_events = epoll_wait(reactor.epoll_fd, events, MAX_REACTOR_EVENTS, timeout);
+  reactor.sleeping = false;
+
+  for (int k = 0; k < n_events; ++k) {
+    if (events[k].data.fd == reactor.wake_fd) {
+      u64 n_wakes;
+      read(reactor.wake_fd, &n_wakes, sizeof(n_wakes));
+    }
+  }
+
+  while (enet_host_service(pnet.server, &event, 0) > 0) {
     switch (event.type) {
     case ENET_EVENT_TYPE_CONNECT:
       printf("handling\n");
@@ -116,6 +183,10 @@ void net_loop() {
     }
   }
 
+  route_messages();
+}
+
+void route_messages() {
   // Send all outgoing messages
   Msg out_mess;
   int n_received = 0;
@@ -125,7 +196,7 @@ void net_loop() {
       continue;
     }
     if (out_mess.node_id == this_pleroma_node->node_id) {
-      net_in_queue.push(out_mess);
+      deliver_msg(out_mess);
     } else {
       send_node_msg(out_mess);
     }
@@ -135,25 +206,6 @@ void net_loop() {
       break;
   }
 
-  // Put incoming messages into the correct mailboxes
-  while (!net_in_queue.empty()) {
-    auto msg_front = net_in_queue.front();
-    sort_queue[msg_front.vat_id].push_back(msg_front);
-    // printf("%d %d %d\n", msg_front.entity_id, msg_front.vat_id,
-    // msg_front.node_id);
-    net_in_queue.pop();
-  }
-  Vat *vat_node;
-  while (net_vats.try_dequeue(vat_node)) {
-    if (sort_queue.find(vat_node->id) != sort_queue.end()) {
-      for (auto zz : sort_queue[vat_node->id]) {
-        vat_node->messages.push(zz);
-      }
-      sort_queue[vat_node->id].clear();
-    }
-
-    queue.enqueue(vat_node);
-  }
 }
 
 void on_receive_packet(ENetEvent *event) {
@@ -176,25 +228,25 @@ void on_receive_packet(ENetEvent *event) {
 
     local_m.promise_id = call.promise_id();
     local_m.response = call.response();
-    local_m.function_name = call.function_id();
+    local_m.method_id = call.method_id();
 
     for (int i = 0; i < call.pvalues_size(); ++i) {
       auto pval = call.pvalues(i);
       if (pval.has_eref_val()) {
         auto eref = pval.eref_val();
-        local_m.values.push_back((ValueNode *)make_entity_ref(eref.node_id(), eref.vat_id(), eref.entity_id()));
+        local_m.values.push_back(make_entity_ref_value(eref.node_id(), eref.vat_id(), eref.entity_id()));
       }
       if (pval.has_num_val()) {
         auto num = pval.num_val();
-        local_m.values.push_back((ValueNode *)make_number(num.value()));
+        local_m.values.push_back(make_number_value(num.value()));
       }
       if (pval.has_str_val()) {
         auto pval_str = pval.str_val();
-        local_m.values.push_back((ValueNode *)make_string(pval_str.value()));
+        local_m.values.push_back(make_object_value(make_string(pval_str.value())));
       }
     }
 
-    net_in_queue.push(local_m);
+    deliver_msg(local_m);
   } else {
     // announce peer
     printf("Got peer announcement!\n");
@@ -247,30 +299,26 @@ void send_node_msg(Msg m) {
 
   call->set_response(m.response);
 
-  call->set_function_id(m.function_name);
-  call->set_src_function_id(m.function_name);
+  call->set_method_id(m.method_id);
 
   call->set_promise_id(m.promise_id);
 
   for (auto &k : m.values) {
     auto pval = call->add_pvalues();
-    if (k->type == AstNodeType::EntityRefNode) {
-      EntityRefNode *node = (EntityRefNode *)k;
+    if (k.tag == ValueTag::EntityRef) {
       romabuf::ERefVal e;
       auto blah = pval->mutable_eref_val();
-      blah->set_node_id(node->node_id);
-      blah->set_vat_id(node->vat_id);
-      blah->set_entity_id(node->entity_id);
-    } else if (k->type == AstNodeType::NumberNode) {
-      NumberNode *node = (NumberNode *)k;
+      blah->set_node_id(k.node_id);
+      blah->set_vat_id(k.ref.vat_id);
+      blah->set_entity_id(k.ref.entity_id);
+    } else if (k.tag == ValueTag::Number) {
       romabuf::NumVal n;
       auto blah = pval->mutable_num_val();
-      blah->set_value(node->value);
-    } else if (k->type == AstNodeType::StringNode) {
-      StringNode *node = (StringNode *)k;
+      blah->set_value(k.number);
+    } else if (is_string(k)) {
       romabuf::StrVal n;
       auto blah = pval->mutable_str_val();
-      blah->set_value(node->value);
+      blah->set_value(extract_string(k.object));
     } else {
       panic("Unhandled value in netcode send.");
     }
@@ -290,6 +338,8 @@ void setup_server(std::string ip, u16 port) {
     exit(EXIT_FAILURE);
   }
   pnet.src_port = port;
+
+  init_reactor();
 }
 
 ENetPeer *pconnect(ENetAddress address) {
@@ -7,14 +7,14 @@
 #include <queue>
 #include <string>
 
-#include "../other_src/blockingconcurrentqueue.h"
-
 extern moodycamel::ConcurrentQueue<Msg> net_out_queue;
-extern moodycamel::BlockingConcurrentQueue<Vat *> queue;
-extern std::queue<Msg> net_in_queue;
 
 void init_network();
 void net_loop();
+
+// Queues a message for another node and wakes the net loop
+void send_net_msg(Msg m);
+void route_messages();
 void setup_server(std::string ip, u16 port);
 void connect_to_client(ENetAddress);
 void connect_to_cluster(ENetAddress);
@@ -26,4 +26,3 @@ void send_node_msg(Msg m);
 void handle_connection(ENetEvent* event);
 ENetAddress mk_netaddr(std::string ip, u16 port);
 
-extern moodycamel::ConcurrentQueue<Vat *> net_vats;
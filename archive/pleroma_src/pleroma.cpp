@@ -17,11 +17,14 @@
 #include <thread>
 
 #include "hylic_compiler.h"
+#include "hylic_optimise.h"
 #include "hylic_typesolver.h"
 #include "netcode.h"
 #include "core/kernel.h"
-#include "../other_src/blockingconcurrentqueue.h"
 #include "node_config.h"
+#include "scheduler.h"
+#include "timer_wheel.h"
+#include "bench.h"
 #include "args.h"
 
 #include "hosted_irq.h"
@@ -29,15 +32,55 @@
 #include "other.h"
 #include "system.h"
 
-//const auto processor_count = std::thread::hardware_concurrency();
-const auto processor_count = 1;
-const int MAX_STEPS = 3;
-
 PleromaNode *this_pleroma_node;
 
-moodycamel::BlockingConcurrentQueue<Vat*> queue;
+bool verbose = false;
+
+std::map<int, Vat *> vats;
+std::shared_mutex vats_mtx;
+
+// Control traffic between the Monad and NodeMen skips ahead of user messages
+std::vector<MethodId> system_functions = {
+  method_hash("new-vat"),
+  method_hash("create-vat"),
+  method_hash("request-far-entity")
+};
+
+Vat *create_vat(PleromaNode *node) {
+  Vat *vat = new Vat;
+  vat->id = node->vat_id_base++;
+  vat->allocator = new VatAllocator;
+
+  // Messages can arrive as soon as the vat is registered, keep it off the
+  // run queues until the creator is done with it
+  vat->state = VatState::Running;
+
+  std::unique_lock<std::shared_mutex> lock(vats_mtx);
+  vats[vat->id] = vat;
+
+  return vat;
+}
+
+Vat *lookup_vat(int vat_id) {
+  std::shared_lock<std::shared_mutex> lock(vats_mtx);
+  auto res = vats.find(vat_id);
+  return res == vats.end() ? nullptr : res->second;
+}
+
+void deliver_msg(Msg m) {
+  Vat *vat = lookup_vat(m.vat_id);
+  if (!vat) {
+    dbp(log_warning, "Dropping message %s for unknown vat %d", method_name(m.method_id).c_str(), m.vat_id);
+    return;
+  }
+
+  bool system_msg = in(m.method_id, system_functions);
+  vat->messages.push(std::move(m), system_msg);
+
+  wake_vat(vat);
+}
 
-Msg create_response(Msg msg_in, AstNode *return_val) {
+Msg response_to(Msg msg_in) {
   Msg response_m;
   response_m.response = true;
 
@@ -50,21 +93,120 @@ Msg create_response(Msg msg_in, AstNode *return_val) {
   response_m.src_node_id = msg_in.node_id;
   response_m.promise_id = msg_in.promise_id;
 
-  response_m.function_name = msg_in.function_name;
+  response_m.method_id = msg_in.method_id;
+
+  return response_m;
+}
+
+Msg create_response(Msg msg_in, const Value &return_val) {
+  Msg response_m = response_to(msg_in);
 
-  if (in(return_val->type, {AstNodeType::NumberNode, AstNodeType::StringNode, AstNodeType::EntityRefNode, AstNodeType::ListNode})) {
-    response_m.values.push_back((ValueNode *)return_val);
+  if (return_val.tag == ValueTag::Number || return_val.tag == ValueTag::EntityRef ||
+      (return_val.tag == ValueTag::Object && in(return_val.object->type, {AstNodeType::StringNode, AstNodeType::RopeNode, AstNodeType::ListNode}))) {
+    response_m.values.push_back(copy_msg_value(return_val));
   } else {
-    panic("Unhandled response value : " + ast_type_to_string(return_val->type));
+    panic("Unhandled response value : " + stringify_value(return_val));
   }
 
   return response_m;
 }
 
-void process_vq() {
-  while (true) {
-    Vat* our_vat;
-    queue.wait_dequeue(our_vat);
+Msg create_rejection(Msg msg_in) {
+  return response_to(msg_in);
+}
+
+// Runs one message against the entity it is addressed to.  Returns the
+// reductions it took.
+u64 process_msg(Vat *our_vat, Msg &m) {
+  Entity* target_entity = find_entity(our_vat, m.entity_id);
+  if (!target_entity) {
+    dbp(log_warning, "Dropping message %s for stale entity %d in vat %d", method_name(m.method_id).c_str(), m.entity_id, our_vat->id);
+    return 0;
+  }
+
+  adopt_msg_values(our_vat, m.values);
+
+  EvalContext context;
+  start_context(&context, this_pleroma_node, our_vat, target_entity->entity_def->module, target_entity);
+
+  // Return vs call
+  if (m.response) {
+    // If we didn't setup a promise to resolve, or it already settled, then ignore the result
+    PromiseResult *promise = our_vat->promises.find(m.promise_id);
+    if (promise && !promise->resolved && !promise->rejected) {
+
+      if (m.values.empty()) {
+        reject_promise(our_vat, m.promise_id);
+      } else {
+        promise->results = m.values;
+        promise->resolved = true;
+        if (promise->callbacks.size() > 0 || promise->dependents.size() > 0) {
+          eval_promise_local(&context, target_entity, promise, m.promise_id);
+        }
+
+        if (promise->return_msg && m.method_id != MAIN_METHOD) {
+          our_vat->out_messages.push(create_response(promise->msg, promise->results[0]));
+        }
+
+        settle_promise(our_vat, promise);
+      }
+
+      // Get return value here, check if we return a promise node, if we do then we need to connect the two
+    }
+  } else {
+    std::vector<Value> args = m.values;
+
+    //printf("Got message with func %s\n", method_name(m.method_id).c_str());
+    // If the result is a promise, setup promise with callback being the real return, and don't send message
+    auto result = eval_func_local(&context, target_entity, m.method_id, args);
+    //print_msg(&m);
+    //printf("%s\n", ast_type_to_string(result->type).c_str());
+    if (result.tag == ValueTag::Promise) {
+      PromiseResult *promise = our_vat->promises.find(result.promise_id);
+      if (promise->rejected) {
+        if (m.method_id != MAIN_METHOD) {
+          our_vat->out_messages.push(create_rejection(m));
+        }
+      } else {
+        promise->return_msg = true;
+        promise->msg = m;
+      }
+    } else {
+      // All return values are singular - we use tuples to represent
+      // multiple return values
+      // FIXME might not work if we handle tuples differently
+      Msg response_m = create_response(m, result);
+
+      // Main cannot be called by any function except ours, move this logic into typechecker
+      if (m.method_id != MAIN_METHOD) {
+        our_vat->out_messages.push(response_m);
+      }
+    }
+  }
+
+  return context.reductions;
+}
+
+void send_out_messages(Vat *our_vat) {
+  while (!our_vat->out_messages.empty()) {
+    Msg out_m = our_vat->out_messages.front();
+    our_vat->out_messages.pop();
+    //print_msg(&out_m);
+
+    // If we're communicating on the same node, we don't have to use the router
+    if (out_m.node_id == this_pleroma_node->node_id) {
+      deliver_msg(out_m);
+    } else {
+      send_net_msg(out_m);
+    }
+  }
+}
+
+void process_vq(Burner *burner) {
+  Vat *our_vat;
+  while ((our_vat = next_vat(burner)) != nullptr) {
+    claim_vat(our_vat);
+    burner->slices++;
 
     our_vat->cycle_since_gc += 1;
 
@@ -73,97 +215,53 @@ void process_vq() {
       our_vat->cycle_since_gc = 0;
     }
 
-    // Take a number of steps
+    // Run until the mailbox is empty or the slice budget is spent
+    int slice_msgs = 0;
+    u64 slice_reductions = 0;
+    bool preempted = false;
+
     for (int k = 0; k < 1; ++k) {
 
-      while (!our_vat->messages.empty()) {
-        Msg m = our_vat->messages.front();
-        our_vat->messages.pop();
-        print_msg(&m);
+      Msg m;
+      while (our_vat->messages.pop(m)) {
+        burner->messages++;
 
-        try {
-          auto find_entity = our_vat->entities.find(m.entity_id);
-          assert(find_entity != our_vat->entities.end());
-          Entity* target_entity = find_entity->second;
+        if (verbose) {
+          print_msg(&m);
+        }
 
-          EvalContext context;
-          start_context(&context, this_pleroma_node, our_vat, target_entity->entity_def->module, target_entity);
-
-          // Return vs call
-          if (m.response) {
-            // If we didn't setup a promise to resolve, then ignore the result
-            if (our_vat->promises.find(m.promise_id) != our_vat->promises.end()) {
-              our_vat->promises[m.promise_id].results = m.values;
-              our_vat->promises[m.promise_id].resolved = true;
-              if (our_vat->promises[m.promise_id].callbacks.size() > 0 || our_vat->promises[m.promise_id].dependents.size() > 0) {
-                eval_promise_local(&context, our_vat->entities.find(m.entity_id)->second, &our_vat->promises[m.promise_id], m.promise_id);
-              }
-
-              if (our_vat->promises[m.promise_id].return_msg) {
-                Msg response_m = create_response(our_vat->promises[m.promise_id].msg, our_vat->promises[m.promise_id].results[0]);
-                if (m.function_name != "main") {
-                  auto ref_res = our_vat->promises[m.promise_id].results[0];
-                  our_vat->out_messages.push(response_m);
-                }
-              }
-
-              // Get return value here, check if we return a promise node, if we do then we need to connect the two
-            }
-          } else {
-            std::vector<AstNode *> args;
-
-            for (int zz = 0; zz < m.values.size(); ++zz) {
-              args.push_back(m.values[zz]);
-            }
-
-            //printf("Got message with func %s\n", m.function_name.c_str());
-            // If the result is a promise, setup promise with callback being the real return, and don't send message
-            auto result = eval_func_local(&context, target_entity, m.function_name, args);
-            //print_msg(&m);
-            //printf("%s\n", ast_type_to_string(result->type).c_str());
-            if (result->type == AstNodeType::PromiseNode) {
-              PromiseNode* prom = (PromiseNode*) result;
-              our_vat->promises[prom->promise_id].return_msg = true;
-              our_vat->promises[prom->promise_id].msg = m;
-            } else {
-              // All return values are singular - we use tuples to represent
-              // multiple return values
-              // FIXME might not work if we handle tuples differently
-              Msg response_m = create_response(m, result);
-
-              // Main cannot be called by any function except ours, move this logic into typechecker
-              if (m.function_name != "main") {
-                our_vat->out_messages.push(response_m);
-              }
-            }
-          }
+        try {
+          slice_reductions += process_msg(our_vat, m);
         } catch (PleromaException &e) {
           printf("PleromaException: %s\n", e.what());
           printf("Calling message: \n");
           print_msg(&m);
           throw;
         }
-      }
 
-      while (!our_vat->out_messages.empty()) {
-        Msg m = our_vat->out_messages.front();
-        our_vat->out_messages.pop();
-        //print_msg(&m);
+        // The handler's context is gone, so is everything it carved
+        our_vat->allocator->reset();
 
-        // If we're communicating on the same node, we don't have to use the router
-        if (m.node_id == this_pleroma_node->node_id && m.vat_id == our_vat->id) {
-          our_vat->messages.push(m);
-        } else {
-          net_out_queue.enqueue(m);
+        slice_msgs++;
+        if (slice_budget_spent(slice_msgs, slice_reductions)) {
+          preempted = !our_vat->messages.empty();
+          break;
         }
       }
 
+      send_out_messages(our_vat);
+
       //sleep(1);
 
       our_vat->run_n++;
     }
 
-    net_vats.enqueue(our_vat);
+    if (preempted) {
+      burner->budget_hits++;
+      yield_vat(our_vat);
+    } else {
+      park_vat(our_vat);
+    }
 
   }
 }
@@ -173,42 +271,41 @@ void start_program(std::string program_name, std::string ent_name) {
   m.node_id = monad_ref->node_id;
   m.vat_id = monad_ref->vat_id;
   m.entity_id = monad_ref->entity_id;
-  m.function_name = "start-program";
+  m.method_id = intern_method("start-program");
 
-  m.values.push_back((StringNode*)make_string(program_name));
-  m.values.push_back((StringNode *)make_string(ent_name));
+  m.values.push_back(make_object_value(make_string(program_name)));
+  m.values.push_back(make_object_value(make_string(ent_name)));
 
   m.src_entity_id = -1;
   m.src_node_id = -1;
   m.src_vat_id = -1;
   m.promise_id = -1;
 
-  net_out_queue.enqueue(m);
+  send_net_msg(m);
 }
 
 void inoculate_pleroma(HylicModule *ukernel, std::string ent0) {
 
   EntityDef *ent0_def = (EntityDef *)ukernel->entity_defs[ent0];
 
-  Vat* og_vat = new Vat;
-  og_vat->id = 0;
-  queue.enqueue(og_vat);
-  this_pleroma_node->vat_id_base++;
-
-  EvalContext context;
-  start_context(&context, this_pleroma_node, og_vat, ukernel, nullptr);
+  Vat* og_vat = create_vat(this_pleroma_node);
 
-  Entity *ent = create_entity(&context, ent0_def, false);
+  // The context carves from the vat's arena, so it has to be gone before
+  // start_vat() hands the vat to a burner
+  Entity *ent;
+  {
+    EvalContext context;
+    start_context(&context, this_pleroma_node, og_vat, ukernel, nullptr);
+    ent = create_entity(&context, ent0_def, false);
+  }
   ent->module_scope = ukernel;
 
   monad_ref = (EntityRefNode*)make_entity_ref(ent->address.node_id, ent->address.vat_id, ent->address.entity_id);
   //printf("%d %d %d\n", monad_ref->node_id, monad_ref->vat_id, monad_ref->entity_id);
 
-  og_vat->entities[0] = ent;
-
   Msg m;
   m.entity_id = 0;
-  m.function_name = "hello";
+  m.method_id = intern_method("hello");
   m.node_id = 0;
 
   m.src_entity_id = -1;
@@ -216,27 +313,29 @@ void inoculate_pleroma(HylicModule *ukernel, std::string ent0) {
   m.src_vat_id = -1;
   m.promise_id = -1;
 
-  m.values.push_back((ValueNode *)make_number(0));
+  m.values.push_back(make_number_value(0));
+
+  deliver_msg(m);
 
-  og_vat->messages.push(m);
+  start_vat(og_vat);
 }
 
 EntityAddress start_system_program(HylicModule *ukernel, std::string ent0) {
 
   EntityDef *ent0_def = (EntityDef *)ukernel->entity_defs[ent0];
 
-  Vat *og_vat = new Vat;
-  og_vat->id = this_pleroma_node->vat_id_base;
-  queue.enqueue(og_vat);
-  this_pleroma_node->vat_id_base++;
+  Vat *og_vat = create_vat(this_pleroma_node);
 
-  EvalContext context;
-  start_context(&context, this_pleroma_node, og_vat, ukernel, nullptr);
-
-  Entity *ent = create_entity(&context, ent0_def, false);
+  // Gone before start_vat(), as in inoculate_pleroma()
+  Entity *ent;
+  {
+    EvalContext context;
+    start_context(&context, this_pleroma_node, og_vat, ukernel, nullptr);
+    ent = create_entity(&context, ent0_def, false);
+  }
   ent->module_scope = ukernel;
 
-  og_vat->entities[0] = ent;
+  start_vat(og_vat);
 
   return ent->address;
 }
@@ -284,12 +383,11 @@ void start_pleroma(PleromaArgs pleroma_args) {
 
   start_program("helloworld", "UserProgram");
 
-  std::thread burners[processor_count];
+  int processor_count = pleroma_args.burners > 0 ? pleroma_args.burners : default_burner_count();
+  init_scheduler(processor_count);
 
   dbp(log_debug, "Starting %d burner processes...", processor_count);
-  for (int k = 0; k < processor_count; ++k) {
-    burners[k] = std::thread(process_vq);
-  }
+  start_burners(process_vq);
 
   std::thread hosted_irq(loop_keyboard);
 
@@ -299,19 +397,126 @@ void start_pleroma(PleromaArgs pleroma_args) {
   }
 
   dbp(log_debug, "Net loop finished, joining all processes");
-  for (int k = 0; k < processor_count; ++k) {
-    burners[k].join();
-  }
+  stop_burners();
 
   dbp(log_info, "Burners joined, exiting.");
 }
 
+// How long a test may leave timers pending before it counts as hung
+const u64 TEST_SETTLE_MS = 2000;
+
+// Runs a test's vat until its mailbox is empty and no timer is left, so a
+// test function sees what the messages and timers of the ones before it did.
+// Returns false if timers are still pending after TEST_SETTLE_MS.
+bool settle_test_vat(Vat *vat) {
+  u64 deadline = timer_now_ms() + TEST_SETTLE_MS;
+
+  while (true) {
+    // Timers that are due go ahead of the replies the last message sent
+    poll_timers();
+    send_out_messages(vat);
+
+    Msg m;
+    if (vat->messages.pop(m)) {
+      process_msg(vat, m);
+      vat->allocator->reset();
+      continue;
+    }
+
+    u64 wait = ms_until_next_timer();
+    if (wait == NO_TIMER && vat->out_messages.empty()) {
+      return true;
+    }
+
+    u64 now = timer_now_ms();
+    if (now >= deadline) {
+      dbp(log_warning, "Timers still pending after %lums", TEST_SETTLE_MS);
+      return false;
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(std::min(wait, deadline - now)));
+  }
+}
+
+// Checks a file, then runs every argument-less function of its standalone
+// entities in turn and prints what each returns, so runs under both engines
+// can be compared.  Returns false if any of them threw.
+bool run_test(PleromaArgs pargs) {
+  this_pleroma_node = new PleromaNode;
+
+  HylicModule *program = load_file("test", pargs.program_path);
+
+  Vat *vat = create_vat(this_pleroma_node);
+  bool passed = true;
+
+  for (auto &[ent_name, v] : program->entity_defs) {
+    auto entity_def = (EntityDef *)v;
+    if (!entity_def->inocaps.empty()) {
+      continue;
+    }
+
+    try {
+      Entity *ent;
+      {
+        EvalContext context;
+        start_context(&context, this_pleroma_node, vat, program, nullptr);
+        ent = create_entity(&context, entity_def, false);
+      }
+      passed = settle_test_vat(vat) && passed;
+
+      for (auto &[func_name, func] : entity_def->functions) {
+        if (!func->args.empty() || func->method_id == CREATE_METHOD) {
+          continue;
+        }
+
+        if (verbose && func->chunk) {
+          printf("%s", disassemble(func->chunk).c_str());
+        }
+
+        // Each function gets a context of its own, settling resets the arena
+        // it was carved from
+        {
+          EvalContext context;
+          start_context(&context, this_pleroma_node, vat, program, nullptr);
+          auto res = eval_func_local(&context, ent, func->method_id, {});
+          printf("%s::%s => %s\n", ent_name.c_str(), func_name.c_str(), stringify_value(res).c_str());
+        }
+        vat->allocator->reset();
+        passed = settle_test_vat(vat) && passed;
+
+        // Later functions only see what the entity still holds
+        run_gc(vat);
+      }
+    } catch (PleromaException &e) {
+      printf("%s => %s\n", ent_name.c_str(), e.what());
+      passed = false;
+    }
+
+    // Settled promises nothing holds have to be reclaimed
+    run_gc(vat);
+    if (vat->promises.size() > 0) {
+      printf("%s => %lu live promises\n", ent_name.c_str(), vat->promises.size());
+    }
+  }
+
+  // Printed as a result, so tests can check what was memoised
+  if (memo_size > 0) {
+    printf("memo => %lu hits, %lu misses\n", vat->memo.hits, vat->memo.misses);
+  }
+
+  return passed;
+}
+
 int main(int argc, char **argv) {
   setlocale(LC_ALL, "");
-  printf("compiling.\n");
-  compile({});
 
   PleromaArgs pargs = parse_args(argc, argv);
+  verbose = pargs.verbose;
+  engine = pargs.engine == "bytecode" ? Engine::Bytecode : Engine::Tree;
+  memo_size = pargs.memo_size;
+  dump_node_counts = pargs.dump_node_counts;
+  slice_budget.messages = pargs.slice_msgs;
+  slice_budget.reductions = pargs.slice_reductions;
 
   std::string debug_pargs = "Using the following options to start Pleroma: \n";
   debug_pargs += "\tLocal host: " + pargs.local_hostname + "\n";
@@ -333,9 +538,10 @@ int main(int argc, char **argv) {
 
   if (pargs.command == PCommand::Start) {
     start_pleroma(pargs);
-  } else if (std::string(argv[1]) == "test") {
-    std::string target_file = argv[2];
-    load_file("test", target_file);
+  } else if (pargs.command == PCommand::Test) {
+    exit(run_test(pargs) ? 0 : 1);
+  } else if (pargs.command == PCommand::Bench) {
+    run_bench(pargs);
     exit(0);
   } else {
     exit(1);
@@ -2,6 +2,7 @@
 
 #include <queue>
 #include <mutex>
+#include <shared_mutex>
 #include <map>
 #include "hylic.h"
 #include "hylic_eval.h"
@@ -9,4 +10,20 @@
 
 extern std::map<int, Vat *> vats;
 
+// Allocates and registers a vat owned by the caller until start_vat()
+Vat *create_vat(PleromaNode *node);
+Vat *lookup_vat(int vat_id);
+
+// A response with no values rejects the caller's promise
+Msg create_rejection(Msg msg_in);
+
+// Pushes a message straight into a local vat's mailbox
+void deliver_msg(Msg m);
+
 extern PleromaNode *this_pleroma_node;
+
+struct Burner;
+void process_vq(Burner *burner);
+
+// Print every message and eref as it is processed (-v)
+extern bool verbose;
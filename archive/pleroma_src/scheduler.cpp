@@ -0,0 +1,297 @@
+#include "scheduler.h"
+#include "../other_src/concurrentqueue.h"
+#include "general_util.h"
+#include "timer_wheel.h"
+
+#include <cassert>
+#include <chrono>
+
+std::vector<Burner *> burners;
+
+SliceBudget slice_budget;
+
+// Vats scheduled from outside a burner (net loop, startup) land here
+moodycamel::ConcurrentQueue<Vat *> injection_queue;
+
+std::mutex idle_mtx;
+std::condition_variable idle_cv;
+std::atomic<int> n_idle{0};
+std::atomic<bool> scheduler_running{false};
+
+thread_local Burner *current_burner = nullptr;
+
+const int INJECTION_BATCH = 8;
+
+// Parked burners are woken explicitly or by the next timer, this only bounds
+// the damage of a bug
+const int IDLE_BACKSTOP_MS = 100;
+
+int default_burner_count() {
+  int n = std::thread::hardware_concurrency();
+  return n > 0 ? n : 1;
+}
+
+void init_scheduler(int n_burners) {
+  assert(burners.empty());
+
+  for (int k = 0; k < n_burners; ++k) {
+    Burner *burner = new Burner;
+    burner->id = k;
+    burners.push_back(burner);
+  }
+}
+
+void start_burners(void (*burner_main)(Burner *)) {
+  scheduler_running = true;
+
+  for (auto burner : burners) {
+    burner->thread = std::thread([burner, burner_main]() {
+      current_burner = burner;
+      burner_main(burner);
+    });
+  }
+}
+
+void stop_burners() {
+  scheduler_running = false;
+
+  {
+    std::lock_guard<std::mutex> lock(idle_mtx);
+    idle_cv.notify_all();
+  }
+
+  for (auto burner : burners) {
+    if (burner->thread.joinable()) {
+      burner->thread.join();
+    }
+  }
+}
+
+void reset_scheduler() {
+  for (auto burner : burners) {
+    delete burner;
+  }
+  burners.clear();
+
+  Vat *vat;
+  while (injection_queue.try_dequeue(vat)) {
+  }
+}
+
+void wake_burner() {
+  // Pairs with the fence in next_vat(): either we see the idle burner or it
+  // sees the vat we just queued
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (n_idle.load() > 0) {
+    std::lock_guard<std::mutex> lock(idle_mtx);
+    idle_cv.notify_one();
+  }
+}
+
+void schedule_vat(Vat *vat) {
+  if (current_burner) {
+    std::lock_guard<std::mutex> lock(current_burner->local_mtx);
+    current_burner->local.push_back(vat);
+  } else {
+    injection_queue.enqueue(vat);
+  }
+
+  wake_burner();
+}
+
+void start_vat(Vat *vat) {
+  vat->state = VatState::Scheduled;
+  schedule_vat(vat);
+}
+
+void wake_vat(Vat *vat) {
+  VatState expected = VatState::Idle;
+  if (vat->state.compare_exchange_strong(expected, VatState::Scheduled)) {
+    schedule_vat(vat);
+  }
+}
+
+void park_vat(Vat *vat) {
+  vat->state = VatState::Idle;
+
+  // A message pushed while we were finishing the slice saw the vat as
+  // Running and did not schedule it
+  if (!vat->messages.empty()) {
+    wake_vat(vat);
+  }
+}
+
+void yield_vat(Vat *vat) {
+  vat->state = VatState::Scheduled;
+
+  if (!current_burner) {
+    schedule_vat(vat);
+    return;
+  }
+
+  // The owner pops from the back, so the front runs last here and first
+  // for a thief
+  {
+    std::lock_guard<std::mutex> lock(current_burner->local_mtx);
+    current_burner->local.push_front(vat);
+  }
+
+  wake_burner();
+}
+
+bool slice_budget_spent(int n_messages, u64 n_reductions) {
+  if (slice_budget.messages > 0 && n_messages >= slice_budget.messages) {
+    return true;
+  }
+
+  if (slice_budget.reductions > 0 && n_reductions >= slice_budget.reductions) {
+    return true;
+  }
+
+  return false;
+}
+
+Vat *pop_local(Burner *burner) {
+  std::lock_guard<std::mutex> lock(burner->local_mtx);
+  if (burner->local.empty()) {
+    return nullptr;
+  }
+
+  Vat *vat = burner->local.back();
+  burner->local.pop_back();
+  return vat;
+}
+
+Vat *pop_injection(Burner *burner) {
+  Vat *batch[INJECTION_BATCH];
+  size_t n = injection_queue.try_dequeue_bulk(batch, INJECTION_BATCH);
+  if (n == 0) {
+    return nullptr;
+  }
+
+  // Keep the rest locally, idle siblings can still steal them
+  if (n > 1) {
+    {
+      std::lock_guard<std::mutex> lock(burner->local_mtx);
+      for (size_t k = 1; k < n; ++k) {
+        burner->local.push_back(batch[k]);
+      }
+    }
+    wake_burner();
+  }
+
+  return batch[0];
+}
+
+// Takes the older half of a victim's deque
+Vat *steal(Burner *burner) {
+  int n_burners = burners.size();
+
+  for (int k = 1; k < n_burners; ++k) {
+    Burner *victim = burners[(burner->id + k) % n_burners];
+
+    std::vector<Vat *> taken;
+    {
+      std::lock_guard<std::mutex> lock(victim->local_mtx);
+      int n_take = (victim->local.size() + 1) / 2;
+      for (int i = 0; i < n_take; ++i) {
+        taken.push_back(victim->local.front());
+        victim->local.pop_front();
+      }
+    }
+
+    if (taken.empty()) {
+      continue;
+    }
+
+    burner->steals++;
+
+    if (taken.size() > 1) {
+      std::lock_guard<std::mutex> lock(burner->local_mtx);
+      for (size_t i = 1; i < taken.size(); ++i) {
+        burner->local.push_back(taken[i]);
+      }
+    }
+
+    return taken[0];
+  }
+
+  return nullptr;
+}
+
+Vat *find_vat(Burner *burner) {
+  if (Vat *vat = pop_local(burner)) {
+    return vat;
+  }
+
+  if (Vat *vat = pop_injection(burner)) {
+    return vat;
+  }
+
+  return steal(burner);
+}
+
+bool work_available() {
+  if (injection_queue.size_approx() > 0) {
+    return true;
+  }
+
+  for (auto burner : burners) {
+    std::lock_guard<std::mutex> lock(burner->local_mtx);
+    if (!burner->local.empty()) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+Vat *next_vat(Burner *burner) {
+  while (scheduler_running) {
+    poll_timers();
+
+    if (Vat *vat = find_vat(burner)) {
+      return vat;
+    }
+
+    // Announce ourselves as idle before the final check, so a concurrent
+    // schedule_vat() either sees us or we see its vat
+    std::unique_lock<std::mutex> lock(idle_mtx);
+    n_idle++;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    u64 wait_ms = std::min<u64>(IDLE_BACKSTOP_MS, ms_until_next_timer());
+    if (!work_available() && scheduler_running && wait_ms > 0) {
+      idle_cv.wait_for(lock, std::chrono::milliseconds(wait_ms));
+    }
+    n_idle--;
+  }
+
+  return nullptr;
+}
+
+void claim_vat(Vat *vat) {
+  VatState expected = VatState::Scheduled;
+  if (!vat->state.compare_exchange_strong(expected, VatState::Running)) {
+    panic("Vat " + std::to_string(vat->id) + " claimed without being scheduled");
+  }
+}
+
+SchedulerStats scheduler_stats() {
+  SchedulerStats stats;
+
+  for (auto burner : burners) {
+    stats.slices += burner->slices;
+    stats.messages += burner->messages;
+    stats.steals += burner->steals;
+    stats.budget_hits += burner->budget_hits;
+  }
+
+  return stats;
+}
+
+void print_scheduler_stats() {
+  for (auto burner : burners) {
+    dbp(log_info, "Burner %d: %lu slices, %lu messages, %lu steals, %lu budget hits", burner->id, (unsigned long)burner->slices.load(),
+        (unsigned long)burner->messages.load(), (unsigned long)burner->steals.load(), (unsigned long)burner->budget_hits.load());
+  }
+}
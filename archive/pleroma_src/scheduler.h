@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common.h"
+#include "hylic_eval.h"
+
+// One burner per core.  Each burner owns a local deque of runnable vats, pulls
+// from the shared injection queue when it runs dry and steals from its
+// siblings after that.
+struct Burner {
+  int id = 0;
+
+  std::mutex local_mtx;
+  std::deque<Vat *> local;
+
+  std::thread thread;
+
+  std::atomic<u64> slices{0};
+  std::atomic<u64> messages{0};
+  std::atomic<u64> steals{0};
+  std::atomic<u64> budget_hits{0};
+};
+
+struct SchedulerStats {
+  u64 slices = 0;
+  u64 messages = 0;
+  u64 steals = 0;
+  u64 budget_hits = 0;
+};
+
+// How much a vat may do before it is preempted, 0 means unlimited.
+// Reductions are evaluated AST nodes; eval is not interruptible, so the
+// budget is checked between messages.
+struct SliceBudget {
+  int messages = 100;
+  u64 reductions = 200000;
+};
+
+extern SliceBudget slice_budget;
+
+extern std::vector<Burner *> burners;
+
+void init_scheduler(int n_burners);
+void start_burners(void (*burner_main)(Burner *));
+void stop_burners();
+void reset_scheduler();
+
+// Makes a vat runnable.  From a burner thread the vat goes onto that burner's
+// local deque, from anywhere else it goes onto the injection queue.
+void schedule_vat(Vat *vat);
+
+// Wakes an idle burner, if any, to look for work or recheck timers
+void wake_burner();
+
+// Hands a vat from its creator to the scheduler
+void start_vat(Vat *vat);
+
+// Schedules a parked vat, called after pushing into its mailbox
+void wake_vat(Vat *vat);
+
+// Parks a vat whose slice drained its mailbox
+void park_vat(Vat *vat);
+
+// Requeues a preempted vat behind the rest of this burner's work
+void yield_vat(Vat *vat);
+
+bool slice_budget_spent(int n_messages, u64 n_reductions);
+
+// Blocks until a vat is runnable, returns nullptr once the scheduler stops
+Vat *next_vat(Burner *burner);
+
+void claim_vat(Vat *vat);
+
+int default_burner_count();
+
+SchedulerStats scheduler_stats();
+void print_scheduler_stats();
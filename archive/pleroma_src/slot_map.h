@@ -0,0 +1,118 @@
+#pragma once
+
+#include <deque>
+#include <vector>
+
+#include "common.h"
+#include "general_util.h"
+
+// Dense table of T addressed by int ids that pack a slot index with the
+// generation of that slot.  Freed slots are reused with a bumped generation,
+// so a stale id (say, in a late response from another node) no longer
+// matches and find() returns nullptr.  Slots live in a deque so pointers
+// returned by find() stay valid while other entries are inserted.
+//
+// Ids are never negative, so -1 stays free as "no such thing".  The first
+// entry in a fresh table gets id 0.
+template <typename T, int IndexBits>
+struct SlotMap {
+  static_assert(IndexBits > 0 && IndexBits < 31, "SlotMap ids must fit in a positive int");
+
+  static const u32 INDEX_MASK = (1u << IndexBits) - 1;
+  static const u32 GENERATION_MASK = (1u << (31 - IndexBits)) - 1;
+
+  struct Slot {
+    u32 generation = 0;
+    bool live = false;
+    T value;
+  };
+
+  std::deque<Slot> slots;
+  std::vector<u32> free_slots;
+  size_t n_live = 0;
+
+  static int make_id(u32 index, u32 generation) { return (int)((generation << IndexBits) | index); }
+  static u32 id_index(int id) { return (u32)id & INDEX_MASK; }
+  static u32 id_generation(int id) { return ((u32)id >> IndexBits) & GENERATION_MASK; }
+
+  int insert(T value) {
+    u32 index;
+    if (!free_slots.empty()) {
+      index = free_slots.back();
+      free_slots.pop_back();
+    } else {
+      if (slots.size() > INDEX_MASK) {
+        panic("SlotMap full");
+      }
+      index = slots.size();
+      slots.emplace_back();
+    }
+
+    Slot &slot = slots[index];
+    slot.live = true;
+    slot.value = std::move(value);
+    n_live++;
+
+    return make_id(index, slot.generation);
+  }
+
+  T *find(int id) {
+    if (id < 0) {
+      return nullptr;
+    }
+
+    u32 index = id_index(id);
+    if (index >= slots.size()) {
+      return nullptr;
+    }
+
+    Slot &slot = slots[index];
+    if (!slot.live || slot.generation != id_generation(id)) {
+      return nullptr;
+    }
+
+    return &slot.value;
+  }
+
+  bool contains(int id) { return find(id) != nullptr; }
+
+  bool erase(int id) {
+    if (!find(id)) {
+      return false;
+    }
+
+    u32 index = id_index(id);
+    Slot &slot = slots[index];
+    slot.live = false;
+    slot.generation = (slot.generation + 1) & GENERATION_MASK;
+    slot.value = T();
+    free_slots.push_back(index);
+    n_live--;
+
+    return true;
+  }
+
+  size_t size() { return n_live; }
+
+  // Visits every live entry as f(id, value)
+  template <typename F>
+  void for_each(F f) {
+    for (u32 index = 0; index < slots.size(); ++index) {
+      Slot &slot = slots[index];
+      if (slot.live) {
+        f(make_id(index, slot.generation), slot.value);
+      }
+    }
+  }
+
+  // Erases every live entry for which pred(id, value) is true
+  template <typename F>
+  void erase_if(F pred) {
+    for (u32 index = 0; index < slots.size(); ++index) {
+      Slot &slot = slots[index];
+      if (slot.live && pred(make_id(index, slot.generation), slot.value)) {
+        erase(make_id(index, slot.generation));
+      }
+    }
+  }
+};
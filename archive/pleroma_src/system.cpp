@@ -1,6 +1,9 @@
 #include "system.h"
 #include "hylic.h"
 #include "hylic_ast.h"
+#include "hylic_compiler.h"
+#include "hylic_optimise.h"
+#include "hylic_resolve.h"
 #include "hylic_typesolver.h"
 #include "core/kernel.h"
 #include "other.h"
@@ -75,6 +78,8 @@ HylicModule *load_system_module(SystemModule mod) {
         }
       }
       file_ent->functions[func_name] = func_def;
+      file_ent->methods[func_def->method_id] = func_def;
+      func_def->entity_def = file_ent;
     }
 
     file_ent->module = program;
@@ -86,6 +91,9 @@ HylicModule *load_system_module(SystemModule mod) {
   }
 
   typesolve(program);
+  optimise(program);
+  resolve(program);
+  compile(program);
 
   return program;
 }
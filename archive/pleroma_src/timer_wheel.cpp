@@ -0,0 +1,241 @@
+#include "timer_wheel.h"
+#include "pleroma.h"
+#include "scheduler.h"
+
+#include <chrono>
+
+TimerWheel timer_wheel;
+
+auto timer_epoch = std::chrono::steady_clock::now();
+
+u64 timer_now_ms() {
+  auto elapsed = std::chrono::steady_clock::now() - timer_epoch;
+  return std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+}
+
+int *timer_slot(TimerWheel *wheel, u64 expires) {
+  u64 delta = expires - wheel->now_tick;
+
+  for (int level = 0; level < WHEEL_LEVELS; ++level) {
+    if (delta < ((u64)1 << (WHEEL_BITS * (level + 1)))) {
+      return &wheel->slots[level][(expires >> (WHEEL_BITS * level)) & (WHEEL_SLOTS - 1)];
+    }
+  }
+
+  return &wheel->far_timers;
+}
+
+void link_timer(TimerWheel *wheel, int index) {
+  Timer *timer = &wheel->timers[index];
+  int *head = timer_slot(wheel, timer->expires);
+
+  timer->head = head;
+  timer->prev = -1;
+  timer->next = *head;
+  if (*head != -1) {
+    wheel->timers[*head].prev = index;
+  }
+  *head = index;
+}
+
+void unlink_timer(TimerWheel *wheel, int index) {
+  Timer *timer = &wheel->timers[index];
+
+  if (timer->prev != -1) {
+    wheel->timers[timer->prev].next = timer->next;
+  } else {
+    *timer->head = timer->next;
+  }
+
+  if (timer->next != -1) {
+    wheel->timers[timer->next].prev = timer->prev;
+  }
+
+  timer->head = nullptr;
+  timer->next = -1;
+  timer->prev = -1;
+}
+
+void free_timer(TimerWheel *wheel, int index) {
+  Timer *timer = &wheel->timers[index];
+  timer->generation++;
+  timer->msg = Msg();
+  wheel->free_timers.push_back(index);
+  wheel->n_active--;
+}
+
+// Re-sorts a slot of a higher level into the levels below it
+void cascade(TimerWheel *wheel, int *head) {
+  int index = *head;
+  *head = -1;
+
+  while (index != -1) {
+    int next = wheel->timers[index].next;
+    link_timer(wheel, index);
+    index = next;
+  }
+}
+
+void fire_slot(TimerWheel *wheel, int *head, std::vector<Msg> *due) {
+  int index = *head;
+
+  while (index != -1) {
+    Timer *timer = &wheel->timers[index];
+    int next = timer->next;
+
+    unlink_timer(wheel, index);
+
+    // The receiving vat takes over the values it's delivered, a periodic
+    // timer keeps its own for the next round
+    if (timer->interval > 0) {
+      Msg m = timer->msg;
+      for (auto &value : m.values) {
+        value = copy_msg_value(value);
+      }
+      due->push_back(m);
+
+      timer->expires = std::max(timer->expires + timer->interval, wheel->now_tick + 1);
+      link_timer(wheel, index);
+    } else {
+      due->push_back(timer->msg);
+      free_timer(wheel, index);
+    }
+
+    index = next;
+  }
+}
+
+void advance_wheel(TimerWheel *wheel, u64 target, std::vector<Msg> *due) {
+  while (wheel->now_tick < target) {
+    if (wheel->n_active == 0) {
+      wheel->now_tick = target;
+      break;
+    }
+
+    wheel->now_tick++;
+    u64 tick = wheel->now_tick;
+
+    // Every level whose lower bits just wrapped hands its current slot down,
+    // highest first
+    int top = 0;
+    while (top + 1 < WHEEL_LEVELS && (tick & (((u64)1 << (WHEEL_BITS * (top + 1))) - 1)) == 0) {
+      top++;
+    }
+
+    if (top == WHEEL_LEVELS - 1 && (tick & (((u64)1 << (WHEEL_BITS * WHEEL_LEVELS)) - 1)) == 0) {
+      cascade(wheel, &wheel->far_timers);
+    }
+
+    for (int level = top; level > 0; --level) {
+      cascade(wheel, &wheel->slots[level][(tick >> (WHEEL_BITS * level)) & (WHEEL_SLOTS - 1)]);
+    }
+
+    fire_slot(wheel, &wheel->slots[0][tick & (WHEEL_SLOTS - 1)], due);
+  }
+}
+
+// Earliest tick anything could be due: the next busy level 0 slot, or the next
+// cascade if level 0 is empty
+u64 find_next_expiry(TimerWheel *wheel) {
+  if (wheel->n_active == 0) {
+    return NO_TIMER;
+  }
+
+  for (u64 tick = wheel->now_tick + 1; tick <= wheel->now_tick + WHEEL_SLOTS; ++tick) {
+    if (wheel->slots[0][tick & (WHEEL_SLOTS - 1)] != -1 || (tick & (WHEEL_SLOTS - 1)) == 0) {
+      return tick;
+    }
+  }
+
+  return wheel->now_tick + WHEEL_SLOTS;
+}
+
+u64 add_timer(u64 delay_ms, u64 interval_ms, Msg msg) {
+  TimerWheel *wheel = &timer_wheel;
+  u64 expires = timer_now_ms() + std::max<u64>(delay_ms, 1);
+
+  std::lock_guard<std::mutex> lock(wheel->mtx);
+
+  int index;
+  if (!wheel->free_timers.empty()) {
+    index = wheel->free_timers.back();
+    wheel->free_timers.pop_back();
+  } else {
+    index = wheel->timers.size();
+    wheel->timers.push_back(Timer());
+    wheel->timers[index].generation = 1;
+  }
+
+  Timer *timer = &wheel->timers[index];
+  timer->expires = std::max(expires, wheel->now_tick + 1);
+  timer->interval = interval_ms;
+  timer->msg = std::move(msg);
+
+  link_timer(wheel, index);
+  wheel->n_active++;
+
+  u64 timer_id = ((u64)timer->generation << 32) | (u32)index;
+
+  // Sleeping burners computed their timeout from the old expiry
+  if (timer->expires < wheel->next_expiry) {
+    wheel->next_expiry = timer->expires;
+    wake_burner();
+  }
+
+  return timer_id;
+}
+
+bool cancel_timer(u64 timer_id) {
+  TimerWheel *wheel = &timer_wheel;
+  u32 index = timer_id & 0xFFFFFFFF;
+  u32 generation = timer_id >> 32;
+
+  std::lock_guard<std::mutex> lock(wheel->mtx);
+
+  if (index >= wheel->timers.size()) {
+    return false;
+  }
+
+  Timer *timer = &wheel->timers[index];
+  if (timer->generation != generation || timer->head == nullptr) {
+    return false;
+  }
+
+  unlink_timer(wheel, index);
+  free_timer(wheel, index);
+  return true;
+}
+
+void poll_timers() {
+  TimerWheel *wheel = &timer_wheel;
+  u64 now = timer_now_ms();
+
+  if (now < wheel->next_expiry.load()) {
+    return;
+  }
+
+  // Another burner is already turning the wheel
+  std::unique_lock<std::mutex> lock(wheel->mtx, std::try_to_lock);
+  if (!lock.owns_lock()) {
+    return;
+  }
+
+  std::vector<Msg> due;
+  advance_wheel(wheel, now, &due);
+  wheel->next_expiry = find_next_expiry(wheel);
+  lock.unlock();
+
+  for (auto &m : due) {
+    deliver_msg(m);
+  }
+}
+
+u64 ms_until_next_timer() {
+  u64 next = timer_wheel.next_expiry.load();
+  if (next == NO_TIMER) {
+    return NO_TIMER;
+  }
+
+  u64 now = timer_now_ms();
+  return next > now ? next - now : 0;
+}
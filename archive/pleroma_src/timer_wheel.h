@@ -0,0 +1,67 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "common.h"
+#include "hylic_eval.h"
+
+// Hierarchical timing wheel, 1ms ticks.  Level 0 holds timers due in the
+// next 64 ticks, each level above covers 64 times the span of the one below
+// and is cascaded down as the wheel turns.  Insert and cancel are O(1).
+const int WHEEL_LEVELS = 4;
+const int WHEEL_BITS = 6;
+const int WHEEL_SLOTS = 1 << WHEEL_BITS;
+
+const u64 NO_TIMER = UINT64_MAX;
+
+struct Timer {
+  u64 expires = 0;
+  u64 interval = 0;
+  u32 generation = 0;
+
+  int next = -1;
+  int prev = -1;
+  int *head = nullptr;
+
+  Msg msg;
+};
+
+struct TimerWheel {
+  std::mutex mtx;
+
+  u64 now_tick = 0;
+  std::atomic<u64> next_expiry{NO_TIMER};
+
+  std::vector<Timer> timers;
+  std::vector<int> free_timers;
+  int n_active = 0;
+
+  int slots[WHEEL_LEVELS][WHEEL_SLOTS];
+  // Beyond the reach of the top level, re-sorted each time it wraps
+  int far_timers = -1;
+
+  TimerWheel() {
+    for (int level = 0; level < WHEEL_LEVELS; ++level) {
+      for (int slot = 0; slot < WHEEL_SLOTS; ++slot) {
+        slots[level][slot] = -1;
+      }
+    }
+  }
+};
+
+extern TimerWheel timer_wheel;
+
+u64 timer_now_ms();
+
+// Delivers msg after delay_ms, then every interval_ms if that is non-zero.
+// Returns an id for cancel_timer().
+u64 add_timer(u64 delay_ms, u64 interval_ms, Msg msg);
+bool cancel_timer(u64 timer_id);
+
+// Fires everything due, called by burners between slices
+void poll_timers();
+
+// How long a burner may sleep before the next timer is due
+u64 ms_until_next_timer();
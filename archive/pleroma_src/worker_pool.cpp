@@ -0,0 +1,102 @@
+#include "worker_pool.h"
+#include "scheduler.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// One parallel_for() call.  Jobs are claimed by bumping next, whoever
+// finishes the last one wakes the caller.
+struct WorkBatch {
+  const std::function<void(int)> *job;
+  int n_jobs = 0;
+
+  std::atomic<int> next{0};
+  std::atomic<int> remaining{0};
+
+  std::mutex done_mtx;
+  std::condition_variable done_cv;
+};
+
+// Never freed, the workers block on it until the process exits
+struct WorkerPool {
+  std::mutex mtx;
+  std::condition_variable cv;
+  std::deque<std::shared_ptr<WorkBatch>> batches;
+  int n_workers = 0;
+};
+
+WorkerPool *pool = nullptr;
+std::once_flag pool_started;
+
+// Runs jobs of the batch until none are left to claim
+void work_on(WorkBatch *batch) {
+  int k;
+  while ((k = batch->next++) < batch->n_jobs) {
+    (*batch->job)(k);
+
+    if (--batch->remaining == 0) {
+      std::lock_guard<std::mutex> lock(batch->done_mtx);
+      batch->done_cv.notify_all();
+    }
+  }
+}
+
+void pool_worker_main() {
+  while (true) {
+    std::shared_ptr<WorkBatch> batch;
+    {
+      std::unique_lock<std::mutex> lock(pool->mtx);
+      pool->cv.wait(lock, [] { return !pool->batches.empty(); });
+
+      batch = pool->batches.front();
+      // Fully claimed batches are finished by whoever holds their jobs
+      if (batch->next >= batch->n_jobs) {
+        pool->batches.pop_front();
+        continue;
+      }
+    }
+
+    work_on(batch.get());
+  }
+}
+
+void start_pool() {
+  pool = new WorkerPool;
+  pool->n_workers = default_burner_count();
+  for (int k = 0; k < pool->n_workers; ++k) {
+    std::thread(pool_worker_main).detach();
+  }
+}
+
+int worker_count() {
+  std::call_once(pool_started, start_pool);
+  return pool->n_workers;
+}
+
+void parallel_for(int n_jobs, const std::function<void(int)> &job) {
+  if (n_jobs <= 0) {
+    return;
+  }
+
+  std::call_once(pool_started, start_pool);
+
+  auto batch = std::make_shared<WorkBatch>();
+  batch->job = &job;
+  batch->n_jobs = n_jobs;
+  batch->remaining = n_jobs;
+
+  {
+    std::lock_guard<std::mutex> lock(pool->mtx);
+    pool->batches.push_back(batch);
+  }
+  pool->cv.notify_all();
+
+  work_on(batch.get());
+
+  std::unique_lock<std::mutex> lock(batch->done_mtx);
+  batch->done_cv.wait(lock, [&] { return batch->remaining == 0; });
+}
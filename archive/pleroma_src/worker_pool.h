@@ -0,0 +1,13 @@
+#pragma once
+
+#include <functional>
+
+// Threads for data-parallel builtins, shared by every burner.  Started on
+// first use with one worker per core.
+//
+// Runs job(0) .. job(n_jobs - 1) and returns once all of them are done.  The
+// calling thread works through the jobs too, so a call makes progress even
+// while every worker is busy with someone else's.
+void parallel_for(int n_jobs, const std::function<void(int)> &job);
+
+int worker_count();
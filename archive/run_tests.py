@@ -4,24 +4,55 @@ import sys, os
 import glob
 import subprocess
 
+ENGINES = ["tree", "bytecode"]
+
+# What the test runner printed for each function it ran
+def results(stdout):
+    return [line for line in str(stdout, 'utf-8').splitlines() if " => " in line]
+
+# What a test has to print, one result per line.  Tests without an
+# .expected file must not print any.
+def expected(test_file):
+    path = os.path.splitext(test_file)[0] + ".expected"
+    if not os.path.exists(path):
+        return []
+    with open(path) as f:
+        return [line for line in f.read().splitlines() if line]
+
+# Extra arguments a test is run with, from its .flags file
+def flags(test_file):
+    path = os.path.splitext(test_file)[0] + ".flags"
+    if not os.path.exists(path):
+        return ""
+    with open(path) as f:
+        return f.read().strip()
+
 all_succeed = True
-for test_file in sorted(glob.glob("tests/*")):
+for test_file in sorted(glob.glob("tests/*.plm")):
+    outputs = {}
+    for engine in ENGINES:
+        outputs[engine] = subprocess.run("./pleroma test {} --engine {} {}".format(test_file, engine, flags(test_file)), shell = True, capture_output = True)
+
     # We expect a failure
     success = False
-    output = subprocess.run("./pleroma test {}".format(test_file), shell = True, capture_output = True)
-    output_code = output.returncode
-
     if "fail" in test_file:
-        success = output_code != 0
+        success = all(o.returncode != 0 for o in outputs.values())
     else:
-        success = output_code == 0
+        success = all(o.returncode == 0 for o in outputs.values())
+
+    # Each engine has to print what's expected, which also makes them agree
+    mismatch = success and "fail" not in test_file and any(results(o.stdout) != expected(test_file) for o in outputs.values())
 
-    if success:
+    if success and not mismatch:
         print("\033[1;32mSuccess:\033[0m {}".format(test_file))
     else:
         all_succeed = False
         print("\033[1;31mFailed:\033[0m {}".format(test_file))
-        print("\t" + str(output.stdout, 'utf-8'))
-        print("\t" + str(output.stderr, 'utf-8'))
+        if mismatch:
+            print("\tExpected:\n\t" + "\n\t".join(expected(test_file)))
+        for engine, o in outputs.items():
+            print("\t[{}]".format(engine))
+            print("\t" + str(o.stdout, 'utf-8'))
+            print("\t" + str(o.stderr, 'utf-8'))
 
 sys.exit(0 if all_succeed else 1)